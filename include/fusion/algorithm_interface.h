@@ -33,21 +33,68 @@ extern "C" {
 /**
   * @brief Initializes the algorithm.
   * @details Initializes the module's algorithms and registers the input sensors.
+  *          The capacities of the configuration are kept until the algorithm is initialized with another one.
+  *          Nothing is allocated, since the lists are stored for the maximum capacities of the build,
+  *          so that a configuration can only lower them.
+  *          A configuration whose max ID is not above the number of fused objects is rejected,
+  *          since some slots could not be given an ID, and the algorithm is left as it was.
+  * @param config The capacities of the algorithm, or NULL for the maximum ones.
+  * @return Whether the configuration was accepted.
+  */
+u8_t InitializeAlgorithm(const AlgorithmConfig_t* config);
+
+/**
+  * @brief Gets the capacities that the algorithm was last initialized with.
+  * @details Used to reinitialize the algorithm with the same capacities (e.g. after a parameter is reconfigured).
+  * @return The capacities of the algorithm (each within its maximum).
+  */
+const AlgorithmConfig_t* GetAlgorithmConfig(void);
+
+/**
+  * @brief Adds an input object of this cycle straight to the prefused object list of the algorithm.
+  * @details Called once per decoded input object (e.g. while its CAN frame is decoded), so that the object
+  *          is converted to native only once, without intermediate lists. Objects of an index that does not belong
+  *          to a configured sensor, or beyond the configured capacity of the prefused object list, are ignored.
+  * @param index The index of the object in the input object list (determines the sensor).
+  * @param sensorObjectId The ID that the sensor tracks the object with (zero if unknown).
+  * @param posX The position of the object in x (m).
+  * @param posY The position of the object in y (m).
+  * @param velX The velocity of the object in x (m/s).
+  * @param velY The velocity of the object in y (m/s).
   * @return Void.
   */
-void InitializeAlgorithm(void);
+void AddInputObject(const u8_t index, const u8_t sensorObjectId, const f32_t posX, const f32_t posY, const f32_t velX, const f32_t velY);
+
+/**
+  * @brief Runs the algorithm for one cycle on the input objects added so far.
+  * @details The algorithm is executed for one cycle on the objects added with `AddInputObject`, which are then cleared.
+  *          The fused object list is converted from native to platform type, straight to the output list.
+  * @param pOutputObjectList The output object list from an external module.
+  * @param dt The time elapsed since the previous cycle (as measured by the platform).
+  * @return Void.
+  */
+void RunAlgorithmOnInputObjects(BaseObject_t* pOutputObjectList, const f32_t dt);
 
 /**
   * @brief Runs the algorithm for one cycle.
-  * @details The input list is converted from platform type to native.
-  *          Then, the algorithm is executed for one cycle and the new fused object
-  *          list is received. The fused object list is converted from native
-  *          back to platform type and is returned.
+  * @details The valid objects of the input list are added with `AddInputObject` (in the order of the list).
+  *          Then, the algorithm is executed for one cycle with `RunAlgorithmOnInputObjects`.
   * @param pInputObjectList The input object list from an external module.
   * @param pOutputObjectList The output object list from an external module.
+  * @param dt The time elapsed since the previous cycle (as measured by the platform).
+  * @return Void.
+  */
+void RunAlgorithm(const BaseObject_t* pInputObjectList, BaseObject_t* pOutputObjectList, const f32_t dt);
+
+/**
+  * @brief Gets the statistics of the association of the last cycle.
+  * @details The time of the association (in s) is measured in every association mode,
+  *          so that the modes can be compared against the time budget of the algorithm.
+  *          The clusters, hypotheses and fallbacks (to GNN) are counted in the JPDA association mode.
+  * @param pStats The statistics of the association.
   * @return Void.
   */
-void RunAlgorithm(const BaseObject_t* pInputObjectList, BaseObject_t* pOutputObjectList);
+void GetAlgorithmStats(AssociationStats_t* pStats);
 
 /*****************************************************************************/
 
@@ -25,11 +25,70 @@ extern "C" {
 /******************************** Inclusions *********************************/
 
 #include "common_types.h"
+#include "real_types.h"
 
 #include "base_types.h"
 
 #include "platform_params.h"
 
+#include "vector_types.h"
+#include "bitmap_types.h"
+
+/***************************** Macro Definitions *****************************/
+
+/**
+  * @defgroup tracker_kernels The kernels that can be selected for the tracker
+  * UD: A single filter for all the states, with a UD factorized covariance matrix.
+  * DECOUPLED: An independent filter per axis (x/vx and y/vy), with a closed-form covariance matrix.
+  *            Valid as long as the process model and the plot's noise are decoupled between the axes.
+  *
+  * @{
+  */
+#define TRACKER_KERNEL_UD        (0u)
+#define TRACKER_KERNEL_DECOUPLED (1u)
+/** @} */
+
+/** The kernel used by the tracker (can be overridden at build time). */
+#ifndef TRACKER_KERNEL
+#define TRACKER_KERNEL (TRACKER_KERNEL_UD)
+#endif
+
+/**
+  * @defgroup track_storages The layouts that a track can be stored with
+  * FULL: The UD factors are stored along with the variances of the predicted covariance matrix.
+  * COMPACT: Only the state, the diagonal factor and the strictly upper part of the unit upper factor are stored,
+  *          and the track storage is aligned to cache lines. The variances are computed from the factors on demand,
+  *          so the gating sees the variances of the latest update instead of the predicted ones.
+  *          The decoupled kernel stores no redundant matrices, so only the alignment applies to it.
+  *
+  * @{
+  */
+#define TRACK_STORAGE_FULL    (0u)
+#define TRACK_STORAGE_COMPACT (1u)
+/** @} */
+
+/** The layout used for the tracks (can be overridden at build time). */
+#ifndef TRACK_STORAGE
+#define TRACK_STORAGE (TRACK_STORAGE_FULL)
+#endif
+
+/** The size of a cache line in bytes. */
+#define CACHE_LINE_SIZE (64u)
+
+/** Aligns the storage of the tracks (e.g. the fused object list) to a cache line, in the compact layout. */
+#if (TRACK_STORAGE == TRACK_STORAGE_COMPACT) && defined(__GNUC__)
+#define TRACK_STORAGE_ALIGNED __attribute__((aligned(CACHE_LINE_SIZE)))
+#else
+#define TRACK_STORAGE_ALIGNED
+#endif
+
+/** Aligns a type to a cache line, so that its records never straddle two lines. */
+#if defined(__GNUC__)
+#define CACHE_LINE_ALIGNED __attribute__((aligned(CACHE_LINE_SIZE)))
+#else
+#define CACHE_LINE_ALIGNED
+#endif
+
 /***************************** Type Definitions ******************************/
 
 /*********************
@@ -39,6 +98,9 @@ extern "C" {
 /** Get the size of an upper matrix, given the dimension. */
 #define GET_SIZE_UPPER(N) ((((N)*(N))+(N)) / 2u)
 
+/** Get the size of a strictly upper matrix (no diagonal), given the dimension. */
+#define GET_SIZE_STRICT_UPPER(N) ((((N)*(N))-(N)) / 2u)
+
 /** Get the size of a diagonal matrix, given the dimension. */
 #define GET_SIZE_DIAGONAL(N) (N)
 
@@ -46,7 +108,7 @@ extern "C" {
 #define GET_UPPER_INDEX(i,j,N) (((N)*(i)) - (((i)*((i) - 1u)) / 2u)) + ((j)-(i))
 
 /** Get the size of an upper matrix in bytes, given the dimension. */
-#define GET_BYTE_UPPER(N) (sizeof(f32_t) * GET_SIZE_UPPER(N))
+#define GET_BYTE_UPPER(N) (sizeof(real_t) * GET_SIZE_UPPER(N))
 
 /**
   * @enum StateType_t
@@ -63,15 +125,43 @@ typedef enum {
 /** The number of the states used in the LKF. */
 #define KALMAN_STATES (STATE_MAX)
 
+/**
+  * @enum AxisType_t
+  * @brief The axes of the decoupled LKF.
+  */
+typedef enum {
+    AXIS_X = 0,
+    AXIS_Y,
+    AXIS_MAX
+} AxisType_t;
+
+/** The number of the axes (decoupled filters) of the LKF. */
+#define KALMAN_AXES (AXIS_MAX)
+
+/** The number of the states of each decoupled filter (pos/vel). */
+#define AXIS_STATES (2u)
+
+/** Get the axis that a state belongs to. */
+#define GET_STATE_AXIS(s) ((s) % KALMAN_AXES)
+
+/** Get the index of a state inside its axis (0 for pos, 1 for vel). */
+#define GET_AXIS_STATE(s) ((s) / KALMAN_AXES)
+
+/** Get a state given its axis and its index inside the axis. */
+#define GET_STATE_FROM_AXIS(a,s) ((a) + ((s) * KALMAN_AXES))
+
 /**
   * @defgroup track_matrices The matrices stored in a track
   *
   * @{
   */
-typedef f32_t KalmanX_t[KALMAN_STATES];
-typedef f32_t KalmanP_t[KALMAN_STATES * KALMAN_STATES];
-typedef f32_t KalmanPu_t[GET_SIZE_UPPER(KALMAN_STATES)];
-typedef f32_t KalmanPd_t[GET_SIZE_DIAGONAL(KALMAN_STATES)];
+typedef real_t KalmanX_t[KALMAN_STATES];
+typedef real_t KalmanP_t[KALMAN_STATES * KALMAN_STATES];
+typedef real_t KalmanPu_t[GET_SIZE_UPPER(KALMAN_STATES)];
+typedef real_t KalmanPus_t[GET_SIZE_STRICT_UPPER(KALMAN_STATES)];
+typedef real_t KalmanPd_t[GET_SIZE_DIAGONAL(KALMAN_STATES)];
+typedef real_t KalmanPv_t[GET_SIZE_DIAGONAL(KALMAN_STATES)];
+typedef real_t KalmanAxisP_t[GET_SIZE_UPPER(AXIS_STATES)];
 /** @} */
 
 /**
@@ -79,23 +169,75 @@ typedef f32_t KalmanPd_t[GET_SIZE_DIAGONAL(KALMAN_STATES)];
   *
   * @{
   */
-typedef f32_t KalmanF_t[KALMAN_STATES * KALMAN_STATES];
-typedef f32_t KalmanQ_t[KALMAN_STATES * KALMAN_STATES];
-typedef f32_t KalmanQu_t[GET_SIZE_UPPER(KALMAN_STATES)];
-typedef f32_t KalmanQd_t[GET_SIZE_DIAGONAL(KALMAN_STATES)];
+typedef real_t KalmanF_t[KALMAN_STATES * KALMAN_STATES];
+typedef real_t KalmanQ_t[KALMAN_STATES * KALMAN_STATES];
+typedef real_t KalmanQu_t[GET_SIZE_UPPER(KALMAN_STATES)];
+typedef real_t KalmanQd_t[GET_SIZE_DIAGONAL(KALMAN_STATES)];
+typedef real_t KalmanAxisQ_t[GET_SIZE_UPPER(AXIS_STATES)];
 /** @} */
 
+/**
+  * @struct KalmanWorkspace_t
+  * @brief The scratch matrices used while estimating the covariance of the predicted state.
+  * @details Owned by the caller, so that the Kalman functions hold no state of their own
+  *          and can be called concurrently with a different workspace each.
+  */
+typedef struct {
+    KalmanF_t F;
+    KalmanQu_t Qu;
+    KalmanQd_t Qd;
+} KalmanWorkspace_t;
+
+/**
+  * @struct TrackingProcess_t
+  * @brief The process model (motion and noise) that the tracks are predicted with, for a given time step.
+  * @details It is read-only after its initialization, so it can be shared by concurrent predictions.
+  */
+#if (TRACKER_KERNEL == TRACKER_KERNEL_DECOUPLED)
+typedef struct {
+    KalmanF_t F;
+    KalmanQ_t Q;
+    real_t dt;
+    KalmanAxisQ_t Qaxis[KALMAN_AXES];
+} TrackingProcess_t;
+#else
+typedef struct {
+    KalmanF_t F;
+    KalmanQ_t Q;
+    KalmanQu_t Qu;
+    KalmanQd_t Qd;
+} TrackingProcess_t;
+#endif
+
+/** The number of the time steps whose process models are cached. */
+#define NUM_CACHED_PROCESSES (8u)
+
+/** The number of the steps per second that a time step is quantized to (1 ms). */
+#define DELTA_TIME_STEPS_PER_SEC (1000u)
+
+/**
+  * @struct TrackingModel_t
+  * @brief A cache of the process models for the recently used time steps.
+  * @details Each process is keyed by its time step, quantized to `DELTA_TIME_STEPS_PER_SEC` (zero means unused).
+  *          When the cache is full, the entries are replaced in a round-robin fashion.
+  */
+typedef struct {
+    u16_t keys[NUM_CACHED_PROCESSES];
+    u8_t nextEntry;
+    TrackingProcess_t processes[NUM_CACHED_PROCESSES];
+} TrackingModel_t;
+
 /**
   * @defgroup plot_matrices The matrices stored in a plot
   *
   * @{
   */
-typedef f32_t KalmanZ_t[KALMAN_STATES];
-typedef f32_t KalmanR_t[KALMAN_STATES * KALMAN_STATES];
+typedef real_t KalmanZ_t[KALMAN_STATES];
+typedef real_t KalmanR_t[KALMAN_STATES * KALMAN_STATES];
 /** @} */
 
 /** The matrix used in the update step for each state. */
-typedef f32_t KalmanH_t[KALMAN_STATES];
+typedef real_t KalmanH_t[KALMAN_STATES];
 
 /***********************
  *** Prefused Object ***
@@ -108,54 +250,384 @@ typedef f32_t KalmanH_t[KALMAN_STATES];
 typedef struct {
     KalmanZ_t Z;
     KalmanR_t R;
-    f32_t weight;
+    real_t weight;
 } Plot_t;
 
+/**
+  * @struct PlotInformation_t
+  * @brief The plots paired with a track during a cycle, accumulated in information (inverse covariance) form.
+  * @details Each plot measures all the states with a diagonal noise, so the information matrix stays diagonal
+  *          and only its diagonal (Y) is stored, along with the information vector (y).
+  */
+typedef struct {
+    u8_t count;
+    real_t y[KALMAN_STATES];
+    real_t Y[KALMAN_STATES];
+} PlotInformation_t;
+
+/** The object ID of a prefused object that its sensor does not report an ID for. */
+#define NO_SENSOR_OBJECT_ID (0u)
+
 /**
   * @struct PrefusedObject_t
   * @brief A prefused (input) object.
+  * @details The sensor object ID is the ID that the sensor tracks the object with (if any).
+  *          The prefused objects of a cycle are kept dense at the front of the list, along with their count.
   */
 typedef struct {
-    u8_t valid;
     Plot_t plot;
 
     const Sensor_t* sensor;
+    u8_t sensorObjectId;
   
-    f32_t priority;
+    real_t priority;
 } PrefusedObject_t;
 
 /********************
  *** Fused Object ***
  *******************/
 
+/**
+  * @defgroup id_constants Constants for ID assigning
+  * The IDs each object can take (the IDs are below the max ID, which can be raised up to `U16_MAX`).
+  * @todo Remove ID completely from object and replace it with a validity flag (ID does not have a practical use anyway).
+  *
+  * @{
+  */
+#define INVALID_ID (0u)
+#ifndef MAX_ID
+#define MAX_ID     (32u)
+#endif
+/** @} */
+
+/** The number of words of the bitmap of the used IDs. */
+#define NUM_ID_WORDS (GET_BITMAP_WORDS(MAX_ID))
+
+/**
+  * @typedef ObjectId_t
+  * @brief The ID of a fused object.
+  */
+typedef u16_t ObjectId_t;
+
+/**
+  * @struct IdAllocator_t
+  * @brief A bitmap of the used IDs, maintained alongside the fused object list.
+  * @details The invalid ID and the bits past the max ID in use are always marked as used.
+  */
+typedef struct {
+    u32_t used[NUM_ID_WORDS];
+} IdAllocator_t;
+
 /**
   * @struct Track_t
   * @brief The track (state) of a fused object.
+  * @details For the decoupled kernel, the covariance matrix of each axis is stored
+  *          as an upper matrix (var pos, cov pos/vel, var vel).
+  *          For the UD kernel, only the factors of the covariance matrix are stored,
+  *          along with the variances (P_V) of the predicted covariance matrix.
+  *          The full covariance matrix is composed on demand (see `GetTrackCovariance`).
+  *          In the compact layout, the unit diagonal of P_U and the variances are not stored (see `track_storages`).
   */
+#if (TRACKER_KERNEL == TRACKER_KERNEL_DECOUPLED)
+typedef struct {
+    KalmanX_t X;
+    KalmanAxisP_t P_AXIS[KALMAN_AXES];
+} Track_t;
+#elif (TRACK_STORAGE == TRACK_STORAGE_COMPACT)
+typedef struct {
+    KalmanX_t X;
+    KalmanPd_t P_D;
+    KalmanPus_t P_US;
+} Track_t;
+#else
 typedef struct {
     KalmanX_t X;
-    KalmanP_t P;
+    KalmanPv_t P_V;
     KalmanPu_t P_U;
     KalmanPd_t P_D;
 } Track_t;
+#endif
+
+/** The capacity of a track batch, rounded up to the vector lanes so that the last block is never out of bounds. */
+#define NUM_BATCH_TRACKS (GET_SIZE_LANES(NUM_FUSED_OBJ))
+
+/**
+  * @struct TrackBatch_t
+  * @brief A batch of tracks stored as a structure of arrays.
+  * @details Each matrix element is stored contiguously for all the tracks of the batch,
+  *          so that the tracks can be processed lane-parallel by the batched kernels.
+  */
+#if (TRACKER_KERNEL == TRACKER_KERNEL_DECOUPLED)
+typedef struct {
+    u8_t count;
+    real_t X[KALMAN_STATES][NUM_BATCH_TRACKS];
+    real_t P_AXIS[KALMAN_AXES][GET_SIZE_UPPER(AXIS_STATES)][NUM_BATCH_TRACKS];
+} TrackBatch_t;
+#else
+typedef struct {
+    u8_t count;
+    real_t X[KALMAN_STATES][NUM_BATCH_TRACKS];
+    real_t P_V[GET_SIZE_DIAGONAL(KALMAN_STATES)][NUM_BATCH_TRACKS];
+    real_t P_U[GET_SIZE_UPPER(KALMAN_STATES)][NUM_BATCH_TRACKS];
+    real_t P_D[GET_SIZE_DIAGONAL(KALMAN_STATES)][NUM_BATCH_TRACKS];
+} TrackBatch_t;
+#endif
 
 /**
   * @struct FusedObject_t
   * @brief A fused (prior & posterior) object.
+  * @details A view of a single object of the fused object store (see `GetFusedObject`).
   * @todo Remove id and replace with a valid flag;
   *       the id will be determined by the objects position in the list!
   */
 typedef struct {
-    u8_t id;
+    ObjectId_t id;
     Track_t track;
     
     u16_t lifetimeCounter;
     u8_t seenThisCycle[NUM_SENSORS];
     u8_t lostCounter;
 
-    f32_t priority;
+    real_t priority;
 } FusedObject_t;
 
+/** The number of words of the bitmap of the used slots of the fused object list. */
+#define NUM_SLOT_WORDS (GET_BITMAP_WORDS(NUM_FUSED_OBJ))
+
+/**
+  * @struct FusedObjectHot_t
+  * @brief The fields of a fused object that are read every cycle, packed into cache lines.
+  * @details The mean and the variances mirror the track of the object (see `UpdateHotFusedObject`),
+  *          so that gating and track management do not touch the full covariance.
+  *          A record fits a single cache line in single precision. In double precision it spans two,
+  *          but the fields of track management (all but the variances) still fit the first one.
+  */
+typedef struct {
+    ObjectId_t id;
+    u8_t lostCounter;
+    u8_t seenThisCycle[NUM_SENSORS];
+    real_t priority;
+    KalmanX_t X;
+    KalmanPv_t variance;
+} CACHE_LINE_ALIGNED FusedObjectHot_t;
+
+/**
+  * @struct FusedObjectCold_t
+  * @brief The fields of a fused object that are only read when it is filtered or output.
+  */
+typedef struct {
+    Track_t track;
+    u16_t lifetimeCounter;
+} TRACK_STORAGE_ALIGNED FusedObjectCold_t;
+
+/**
+  * @struct FusedObjectStore_t
+  * @brief The fused objects split into hot and cold records, indexed by the fused object list.
+  * @details A loop over the objects that only reads the hot fields (e.g. to prune them or build the gating lanes)
+  *          streams one record per object and skips the tracks.
+  *          The split is a layout change: it cuts the lines that such a loop reads, but the objects of a cycle fit the L1
+  *          anyway, and the gain of the gating comes from reading the stored variances instead of composing them. The live (valid) objects are kept in a bitmap,
+  *          so that the loops visit only them, in ascending order (see `GetNextLiveFusedObject`).
+  */
+typedef struct {
+    FusedObjectHot_t hot[NUM_FUSED_OBJ];
+    FusedObjectCold_t cold[NUM_FUSED_OBJ];
+    u32_t live[NUM_SLOT_WORDS];
+} FusedObjectStore_t;
+
+/*********************
+ *** Priority Heap ***
+ ********************/
+
+/** The position in the priority heap of an object that is not in it. */
+#define INVALID_HEAP_POSITION (U8_MAX)
+
+/**
+  * @struct PriorityHeap_t
+  * @brief A min-heap of the valid fused objects by priority, used to find the object to be replaced by a new one.
+  * @details The objects are kept by their index in the fused object list and their priority is read from the list.
+  *          The used slots of the list are kept in a bitmap, so that the first free slot is found without a scan.
+  *          The bits past the last slot in use (the capacity) are always set.
+  */
+typedef struct {
+    u8_t capacity;
+    u8_t count;
+    u8_t heap[NUM_FUSED_OBJ];
+    u8_t position[NUM_FUSED_OBJ];
+    u32_t usedSlots[NUM_SLOT_WORDS];
+} PriorityHeap_t;
+
+/******************
+ *** Track Grid ***
+ *****************/
+
+/** The number of the buckets of the track grid (a power of two, up to 64 so that a query fits a 64-bit mask). */
+#define NUM_GRID_BUCKETS (64u)
+
+/** The max number of cells that a query visits, before it falls back to returning all the tracks. */
+#define MAX_GRID_QUERY_CELLS (16u)
+
+/** The number of tracks up to which a query returns all the tracks, since checking them all is cheaper. */
+#define MIN_GRID_QUERY_TRACKS (12u)
+
+/** The index that marks an empty bucket, the end of a chain or a track that is not in the grid. */
+#define INVALID_GRID_INDEX (U8_MAX)
+
+/**
+  * @struct TrackGrid_t
+  * @brief A uniform grid over the positions of the tracks, used to find the gating candidates of a plot.
+  * @details The cells are hashed to a fixed number of buckets and the tracks of each bucket
+  *          are chained by their index in the fused object list.
+  *          The max position variances of the tracks in the grid bound the size of the acceptance gate.
+  */
+typedef struct {
+    u8_t count;
+    u8_t head[NUM_GRID_BUCKETS];
+    u8_t next[NUM_FUSED_OBJ];
+    u8_t bucket[NUM_FUSED_OBJ];
+    real_t maxVariance[KALMAN_AXES];
+} TrackGrid_t;
+
+/**************
+ *** Gating ***
+ *************/
+
+/** The number of words of the bitmap of the changed gating tracks. */
+#define NUM_GATING_WORDS (GET_BITMAP_WORDS(NUM_BATCH_TRACKS))
+
+/**
+  * The number of worker threads that gate the plots of the sensors in parallel with the calling thread.
+  * Zero gates serially. On a multi-core target, (NUM_SENSORS - 1) gives a core to each sensor.
+  * A job costs a thread wake-up, so it only pays off when the gating of a sensor takes longer than that.
+  */
+#ifndef GATING_WORKERS
+#define GATING_WORKERS (0u)
+#endif
+
+/**
+  * @struct GatingTracks_t
+  * @brief The means and variances of the tracks stored as a structure of arrays, used by the gating of the plots.
+  * @details Indexed by the fused object list, so that a plot is gated against all the tracks lane-parallel.
+  *          The acceptance interval (lower and upper bound) of the position in each axis is kept for the pre-gate.
+  *          The lanes set since the changes were last cleared are marked, so that gating values computed
+  *          before can be brought up to date lane by lane.
+  *          Lanes of invalid objects hold stale values and must be ignored by the caller.
+  */
+typedef struct {
+    real_t mean[KALMAN_STATES][NUM_BATCH_TRACKS];
+    real_t variance[KALMAN_STATES][NUM_BATCH_TRACKS];
+    real_t lower[KALMAN_AXES][NUM_BATCH_TRACKS];
+    real_t upper[KALMAN_AXES][NUM_BATCH_TRACKS];
+    u32_t changed[NUM_GATING_WORDS];
+} GatingTracks_t;
+
+/******************
+ *** Assignment ***
+ *****************/
+
+/** The max number of rows (plots of a sensor) of an assignment problem. */
+#define MAX_ASSIGNMENT_ROWS (NUM_PREFUSED_OBJ)
+
+/** The max number of columns (fused objects and one dummy per plot) of an assignment problem. */
+#define MAX_ASSIGNMENT_COLS (NUM_FUSED_OBJ + NUM_PREFUSED_OBJ)
+
+/**
+  * @struct AssignmentWorkspace_t
+  * @brief The cost matrix and the scratch buffers of the assignment solver.
+  * @details Owned by the caller, so that no memory is allocated while solving.
+  *          The potentials and the path buffers are indexed from 1, index 0 is the virtual start column.
+  */
+typedef struct {
+    real_t cost[MAX_ASSIGNMENT_ROWS][MAX_ASSIGNMENT_COLS];
+    real_t rowPotential[MAX_ASSIGNMENT_ROWS + 1u];
+    real_t colPotential[MAX_ASSIGNMENT_COLS + 1u];
+    real_t minSlack[MAX_ASSIGNMENT_COLS + 1u];
+    u8_t colRow[MAX_ASSIGNMENT_COLS + 1u];
+    u8_t colPath[MAX_ASSIGNMENT_COLS + 1u];
+    u8_t colVisited[MAX_ASSIGNMENT_COLS + 1u];
+} AssignmentWorkspace_t;
+
+/************
+ *** JPDA ***
+ ***********/
+
+/** The column of the marginal probability that a plot is not paired with any fused object. */
+#define JPDA_NONE_COL (NUM_FUSED_OBJ)
+
+/** The number of nodes (plots and fused objects) of the union-find of the clusters. */
+#define NUM_JPDA_NODES (MAX_ASSIGNMENT_ROWS + NUM_FUSED_OBJ)
+
+/**
+  * @struct JpdaWorkspace_t
+  * @brief The marginal association probabilities and the scratch buffers of the JPDA solver.
+  * @details Owned by the caller, so that no memory is allocated while solving.
+  *          The options of a row are its gated fused objects, followed by the option of not being paired.
+  *          The hypothesis weights are accumulated in double precision, since they are products over the plots of a cluster.
+  */
+typedef struct {
+    real_t marginal[MAX_ASSIGNMENT_ROWS][NUM_FUSED_OBJ + 1u];
+    u8_t fallback[MAX_ASSIGNMENT_ROWS];
+    u8_t parent[NUM_JPDA_NODES];
+    u8_t clusterRows[MAX_ASSIGNMENT_ROWS];
+    u8_t numOptions[MAX_ASSIGNMENT_ROWS];
+    u8_t options[MAX_ASSIGNMENT_ROWS][NUM_FUSED_OBJ];
+    u8_t choice[MAX_ASSIGNMENT_ROWS];
+    u8_t used[NUM_FUSED_OBJ];
+    f64_t likelihood[MAX_ASSIGNMENT_ROWS][NUM_FUSED_OBJ + 1u];
+    f64_t optionWeight[MAX_ASSIGNMENT_ROWS][NUM_FUSED_OBJ + 1u];
+    f64_t weight[MAX_ASSIGNMENT_ROWS + 1u];
+} JpdaWorkspace_t;
+
+/**
+  * @struct AssociationStats_t
+  * @brief The cost of the association of a cycle.
+  * @details The clusters and hypotheses are only counted by the JPDA association mode.
+  *          A fallback is a cluster with more hypotheses than allowed, that was associated as GNN instead.
+  */
+typedef struct {
+    u32_t clusters;
+    u32_t hypotheses;
+    u32_t fallbacks;
+    f32_t time;
+} AssociationStats_t;
+
+/************************
+ *** Association Hint ***
+ ***********************/
+
+/**
+  * @struct AssociationHint_t
+  * @brief The fused object that an object ID of a sensor was last associated with.
+  * @details The fused object is kept by its index in the fused object list and its ID,
+  *          so that a hint to an object that was replaced since is not followed.
+  *          An invalid ID marks that there is no hint.
+  */
+typedef struct {
+    u8_t index;
+    ObjectId_t id;
+} AssociationHint_t;
+
+/*********************
+ *** Configuration ***
+ ********************/
+
+/**
+  * @struct AlgorithmConfig_t
+  * @brief The capacities of the algorithm, set when it is initialized.
+  * @details The lists are stored statically for the compile-time maximum of each capacity
+  *          (`NUM_PREFUSED_OBJ`, `NUM_FUSED_OBJ`, `NUM_SENSORS` and `MAX_ID`), so that the same build serves any smaller
+  *          configuration without allocating during the cycle. A capacity of zero, or above its maximum, is set to the maximum.
+  *          The association and the maintenance of the objects run up to the configured sensors and the output up to the
+  *          configured fused objects, while the storage stays sized for the maxima.
+  *          A vehicle that needs more than a maximum (e.g. more than `NUM_SENSORS` radars) needs a build with it raised.
+  */
+typedef struct {
+    u8_t numPrefusedObjects;
+    u8_t numFusedObjects;
+    u8_t numSensors;
+    ObjectId_t maxId;
+} AlgorithmConfig_t;
+
 /*****************************************************************************/
 
 #ifdef __cplusplus
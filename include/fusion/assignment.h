@@ -0,0 +1,51 @@
+/*
+ * Copyright (C) 2016 Dimitris Geromichalos
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ASSIGNMENT_H
+#define ASSIGNMENT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************** Inclusions *********************************/
+
+#include "algorithm_types.h"
+
+/***************************** Public Functions ******************************/
+
+/**
+  * @brief Solves a (rectangular) linear assignment problem.
+  * @details Each row is assigned to a different column, so that the sum of the costs is minimized.
+  *          The cost matrix is read from the workspace (`cost[row][col]`).
+  *          The Hungarian method with shortest augmenting paths (Jonker-Volgenant) is used.
+  *          It runs in O(rows^2 * cols) regardless of the costs, and needs no memory other than the workspace.
+  * @param workspace The workspace that holds the cost matrix and the scratch buffers.
+  * @param rows The number of rows (up to `MAX_ASSIGNMENT_ROWS`).
+  * @param cols The number of columns (at least rows, up to `MAX_ASSIGNMENT_COLS`).
+  * @param assignment The column assigned to each row.
+  * @return Void.
+  */
+void SolveAssignment(AssignmentWorkspace_t* workspace, const u8_t rows, const u8_t cols, u8_t* assignment);
+
+/*****************************************************************************/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* ASSIGNMENT_H */
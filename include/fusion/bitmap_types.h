@@ -0,0 +1,160 @@
+/*
+ * Copyright (C) 2016 Dimitris Geromichalos
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef BITMAP_TYPES_H
+#define BITMAP_TYPES_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************** Inclusions *********************************/
+
+#include "common_types.h"
+
+/***************************** Macro Definitions *****************************/
+
+/** The number of bits of a word of a bitmap. */
+#define BITMAP_WORD_BITS (32u)
+
+/** Get the number of words of a bitmap, given the number of bits. */
+#define GET_BITMAP_WORDS(N) (((N) + BITMAP_WORD_BITS - 1u) / BITMAP_WORD_BITS)
+
+/***************************** Public Functions ******************************/
+
+/**
+  * @brief Sets a bit of a bitmap.
+  * @param bitmap The words of the bitmap.
+  * @param bit The index of the bit.
+  * @return Void.
+  */
+static inline void SetBitmapBit(u32_t* bitmap, const u32_t bit)
+{
+    bitmap[bit / BITMAP_WORD_BITS] |= (1u << (bit % BITMAP_WORD_BITS));
+}
+
+/**
+  * @brief Clears a bit of a bitmap.
+  * @param bitmap The words of the bitmap.
+  * @param bit The index of the bit.
+  * @return Void.
+  */
+static inline void ClearBitmapBit(u32_t* bitmap, const u32_t bit)
+{
+    bitmap[bit / BITMAP_WORD_BITS] &= ~(1u << (bit % BITMAP_WORD_BITS));
+}
+
+/**
+  * @brief Checks if a bit of a bitmap is set.
+  * @param bitmap The words of the bitmap.
+  * @param bit The index of the bit.
+  * @return Whether the bit is set.
+  */
+static inline u8_t IsBitmapBitSet(const u32_t* bitmap, const u32_t bit)
+{
+    return (((bitmap[bit / BITMAP_WORD_BITS] >> (bit % BITMAP_WORD_BITS)) & 1u) != 0u);
+}
+
+/**
+  * @brief Finds the first zero bit of a bitmap.
+  * @details The first word that is not full is found and its first zero bit is counted
+  *          (a single instruction with GCC), so that the cost is one step per 32 bits.
+  * @param bitmap The words of the bitmap.
+  * @param numWords The number of words of the bitmap.
+  * @return The index of the first zero bit, or the number of bits of the bitmap if all the bits are set.
+  */
+static inline u32_t FindFirstZeroBit(const u32_t* bitmap, const u32_t numWords)
+{
+    u32_t i;
+    u32_t word;
+    u32_t bit = numWords * BITMAP_WORD_BITS;
+
+    for (i = 0u; i < numWords; i++)
+    {
+        if (bitmap[i] != U32_MAX)
+        {
+            word = ~bitmap[i];
+#if defined(__GNUC__)
+            bit = (i * BITMAP_WORD_BITS) + (u32_t)__builtin_ctz(word);
+#else
+            bit = i * BITMAP_WORD_BITS;
+
+            while ((word & 1u) == 0u)
+            {
+                word >>= 1u;
+                bit++;
+            }
+#endif
+            break;
+        }
+    }
+
+    return bit;
+}
+
+/**
+  * @brief Finds the next set bit of a bitmap, starting from a given bit.
+  * @details The bits below the given one are masked out of its word, and the first word that is not empty
+  *          is found and its first set bit is counted, so that the set bits are visited in ascending order
+  *          at a cost of one step per 32 bits.
+  * @param bitmap The words of the bitmap.
+  * @param numWords The number of words of the bitmap.
+  * @param bit The index of the first bit to be checked.
+  * @return The index of the next set bit, or the number of bits of the bitmap if there is none.
+  */
+static inline u32_t FindNextSetBit(const u32_t* bitmap, const u32_t numWords, const u32_t bit)
+{
+    u32_t i = bit / BITMAP_WORD_BITS;
+    u32_t word = 0u;
+    u32_t next = numWords * BITMAP_WORD_BITS;
+
+    if (i < numWords)
+    {
+        word = bitmap[i] & (U32_MAX << (bit % BITMAP_WORD_BITS));
+
+        while ((word == 0u) && ((i + 1u) < numWords))
+        {
+            i++;
+            word = bitmap[i];
+        }
+    }
+
+    if (word != 0u)
+    {
+#if defined(__GNUC__)
+        next = (i * BITMAP_WORD_BITS) + (u32_t)__builtin_ctz(word);
+#else
+        next = i * BITMAP_WORD_BITS;
+
+        while ((word & 1u) == 0u)
+        {
+            word >>= 1u;
+            next++;
+        }
+#endif
+    }
+
+    return next;
+}
+
+/*****************************************************************************/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* BITMAP_TYPES_H */
@@ -25,6 +25,7 @@ extern "C" {
 /******************************** Inclusions *********************************/
 
 #include "common_types.h"
+#include "real_types.h"
 
 /*********************** Global Variable Declarations ************************/
 
@@ -36,10 +37,10 @@ extern "C" {
   *
   * @{
   */
-extern f32_t SIGMA_BASE;
-extern f32_t SIGMA_RANGE;
-extern f32_t SIGMA_DOPPLER;
-extern f32_t SIGMA_BEARING;
+extern real_t SIGMA_BASE;
+extern real_t SIGMA_RANGE;
+extern real_t SIGMA_DOPPLER;
+extern real_t SIGMA_BEARING;
 /** @} */
 
 /**
@@ -54,9 +55,9 @@ extern f32_t SIGMA_BEARING;
   *
   * @{
   */
-extern f32_t MAX_BEARING_CONFIDENCE;
-extern f32_t MIN_BEARING_CONFIDENCE;
-extern f32_t SENSOR_WEAK_BEARING_AREA;
+extern real_t MAX_BEARING_CONFIDENCE;
+extern real_t MIN_BEARING_CONFIDENCE;
+extern real_t SENSOR_WEAK_BEARING_AREA;
 /** @} */
 
 /**
@@ -65,10 +66,10 @@ extern f32_t SENSOR_WEAK_BEARING_AREA;
   *
   * @{
   */
-extern f32_t Q_SIGMA_X;
-extern f32_t Q_SIGMA_Y;
-extern f32_t Q_SIGMA_VX;
-extern f32_t Q_SIGMA_VY;
+extern real_t Q_SIGMA_X;
+extern real_t Q_SIGMA_Y;
+extern real_t Q_SIGMA_VX;
+extern real_t Q_SIGMA_VY;
 /** @} */
 
 /**
@@ -78,10 +79,10 @@ extern f32_t Q_SIGMA_VY;
   *
   * @{
   */
-extern f32_t PRUNE_LIMIT_X;
-extern f32_t PRUNE_LIMIT_Y;
-extern f32_t PRUNE_LIMIT_VX;
-extern f32_t PRUNE_LIMIT_VY;
+extern real_t PRUNE_LIMIT_X;
+extern real_t PRUNE_LIMIT_Y;
+extern real_t PRUNE_LIMIT_VX;
+extern real_t PRUNE_LIMIT_VY;
 /** @} */
 
 /**
@@ -94,11 +95,11 @@ extern f32_t PRUNE_LIMIT_VY;
   *
   * @{
   */
-extern f32_t GATING_WEIGHT_X;
-extern f32_t GATING_WEIGHT_Y;
-extern f32_t GATING_WEIGHT_VX;
-extern f32_t GATING_WEIGHT_VY;
-extern f32_t ACCEPTANCE_GATE_SUM_FACTOR;
+extern real_t GATING_WEIGHT_X;
+extern real_t GATING_WEIGHT_Y;
+extern real_t GATING_WEIGHT_VX;
+extern real_t GATING_WEIGHT_VY;
+extern real_t ACCEPTANCE_GATE_SUM_FACTOR;
 /** @} */
 
 /**
@@ -111,8 +112,8 @@ extern f32_t ACCEPTANCE_GATE_SUM_FACTOR;
   * @{
   */
 extern u8_t MAX_COASTING_CYCLES;
-extern f32_t MIN_COASTING_DIST;
-extern f32_t MAX_COASTING_DIST;
+extern real_t MIN_COASTING_DIST;
+extern real_t MAX_COASTING_DIST;
 /** @} */
 
 /**
@@ -126,8 +127,8 @@ extern f32_t MAX_COASTING_DIST;
   *
   * @{
   */
-extern f32_t MAX_VELOCITY;
-extern f32_t MIN_VELOCITY;
+extern real_t MAX_VELOCITY;
+extern real_t MIN_VELOCITY;
 /** @} */
 
 /**
@@ -140,6 +141,26 @@ extern f32_t MIN_VELOCITY;
 extern u8_t MIN_LIFETIME_TX_CYCLES;
 /** @} */
 
+/**
+  * @defgroup update_mode The update mode of the algorithm
+  * Determines how the plots paired with a track during a cycle are fused (see `update_modes`).
+  *
+  * @{
+  */
+extern u8_t UPDATE_MODE;
+/** @} */
+
+/**
+  * @defgroup association_mode The association mode of the algorithm
+  * Determines how the prefused objects are paired with the fused objects (see `association_modes`).
+  * The max hypotheses bound the cost of a cluster of the JPDA association mode, which is associated as GNN above it.
+  *
+  * @{
+  */
+extern u8_t ASSOCIATION_MODE;
+extern u16_t JPDA_MAX_HYPOTHESES;
+/** @} */
+
 /*****************************************************************************/
 
 #ifdef __cplusplus
@@ -29,17 +29,6 @@ extern "C" {
 
 /********************************* Constants *********************************/
 
-/**
-  * @defgroup id_constants Constants for ID assigning
-  * The IDs each object can take.
-  * @todo Remove ID completely from object and replace it with a validity flag (ID does not have a practical use anyway).
-  *
-  * @{
-  */
-#define INVALID_ID (0u)
-#define MAX_ID     (32u)
-/** @} */
-
 /** Priority of each object that is determined by range (zero range means max priority).
   * @todo Calculate from the objects max limits for x and y.
   */
@@ -61,10 +50,82 @@ extern "C" {
   * @defgroup gating_limits The parameters of the acceptance gate
   * State limit: The minimum limit for two gaussians to be considered similar. Based on the 3-sigma rule (99.7%).
   * Total limit: The sum of all states should be above this limit for a plot to pass the acceptance gate.
+  * Interval margin: The relative margin added to the half width of an acceptance interval (pre-gate), to absorb rounding.
   *
   * @{
   */
 #define STATE_GATING_VALUE_MIN_LIMIT (0.1f)
+#define GATING_INTERVAL_MARGIN       (1.01f)
+/** @} */
+
+/**
+  * @defgroup delta_time_limits The limits of the time step of the prediction
+  * A measured time step outside the limits (e.g. after a stalled cycle) is clamped.
+  *
+  * @{
+  */
+#define MIN_DELTA_TIME (0.001f)
+#define MAX_DELTA_TIME (0.5f)
+/** @} */
+
+/**
+  * @defgroup track_grid_constants Constants for the track grid
+  * Cell size: The size (in m) of each square cell of the grid.
+  * Max cell: The limit of the cell coordinates, so that far away positions do not overflow.
+  * Radius margin: The relative margin added to the radius of a box, to absorb rounding.
+  *
+  * @{
+  */
+#define GRID_CELL_SIZE     (25.f)
+#define GRID_MAX_CELL      (1000000.f)
+#define GRID_RADIUS_MARGIN (1.01f)
+/** @} */
+
+/**
+  * @defgroup update_modes The modes that the plots can be fused with
+  * Sequential: Each plot is fused with its paired track as soon as it is associated.
+  * Information: The plots are accumulated in information form and each track is fused once per cycle,
+  *              so the cost of the update is almost independent of the number of overlapping sensors.
+  *              The plots of a cycle are gated against the predicted tracks.
+  *              The weight of a plot inflates its noise (R / weight), instead of scaling its innovation.
+  *
+  * @{
+  */
+#define UPDATE_MODE_SEQUENTIAL  (0u)
+#define UPDATE_MODE_INFORMATION (1u)
+/** @} */
+
+/**
+  * @defgroup association_modes The modes that the prefused objects can be associated with
+  * Greedy: Each prefused object is paired with the fused object of its best gating value, in the order of the list.
+  * GNN: The prefused objects of each sensor are paired with the fused objects at once (global nearest neighbour),
+  *      so that the sum of the gating values is maximized and each fused object is paired with one of them at most.
+  *      The sensors are told apart by their index and processed in order, up to the configured number of sensors,
+  *      so that overlapping sensors that see the same object are each paired with its fused object.
+  * JPDA: The prefused objects of each sensor are paired with the fused objects in probability (joint probabilistic data association).
+  *       Each fused object is fused with the probability-weighted mean of its gated prefused objects,
+  *       and a new object is created from each prefused object that is most probably not paired.
+  *       The hypotheses are enumerated per cluster of prefused objects of the same sensor that share fused objects,
+  *       so that a fused object takes one prefused object of each sensor at most per scan.
+  *
+  * @{
+  */
+#define ASSOCIATION_MODE_GREEDY (0u)
+#define ASSOCIATION_MODE_GNN    (1u)
+#define ASSOCIATION_MODE_JPDA   (2u)
+/** @} */
+
+/**
+  * @defgroup assignment_costs The costs of the special pairs of the assignment problem
+  * Dummy: The cost of leaving a plot unpaired (a new object is created from it).
+  * Forbidden: The cost of a pair outside the acceptance gate, worse than any dummy so it is never chosen.
+  * Infinite: Bigger than any cost, used as the initial slack of the solver.
+  *
+  * @{
+  */
+#define DUMMY_ASSIGNMENT_COST     (0.f)
+#define FORBIDDEN_ASSIGNMENT_COST (1.f)
+#define INFINITE_ASSIGNMENT_COST  (1e30f)
 /** @} */
 
 /*****************************************************************************/
@@ -0,0 +1,96 @@
+/*
+ * Copyright (C) 2016 Dimitris Geromichalos
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef FUSED_OBJECT_STORE_H
+#define FUSED_OBJECT_STORE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************** Inclusions *********************************/
+
+#include "algorithm_types.h"
+
+/***************************** Public Functions ******************************/
+
+/**
+  * @brief Invalidates all the objects of a store and clears their fields.
+  * @param store The store to be reset.
+  * @return Void.
+  */
+void ResetFusedObjectStore(FusedObjectStore_t* store);
+
+/**
+  * @brief Marks an object of a store as live (valid) or not.
+  * @details Must be called whenever the ID of the object is set or cleared.
+  * @param store The store of the fused objects.
+  * @param index The index of the object in the store.
+  * @param live Whether the object is live.
+  * @return Void.
+  */
+void SetFusedObjectLive(FusedObjectStore_t* store, const u8_t index, const u8_t live);
+
+/**
+  * @brief Gets the next live object of a store, starting from a given index.
+  * @details A loop over the live objects is written as
+  *          `for (i = GetNextLiveFusedObject(store, 0u); i < NUM_FUSED_OBJ; i = GetNextLiveFusedObject(store, i + 1u))`.
+  * @param store The store of the fused objects.
+  * @param index The index of the first object to be checked.
+  * @return The index of the next live object, or `NUM_FUSED_OBJ` if there is none.
+  */
+static inline u8_t GetNextLiveFusedObject(const FusedObjectStore_t* store, const u8_t index)
+{
+    u32_t next = FindNextSetBit(store->live, NUM_SLOT_WORDS, index);
+
+    return (next < NUM_FUSED_OBJ) ? (u8_t)next : NUM_FUSED_OBJ;
+}
+
+/**
+  * @brief Copies the mean and the variances of the track of an object to its hot record.
+  * @details Must be called whenever the track of the object is modified.
+  * @param store The store of the fused objects.
+  * @param index The index of the object in the store.
+  * @return Void.
+  */
+void UpdateHotFusedObject(FusedObjectStore_t* store, const u8_t index);
+
+/**
+  * @brief Gathers the fields of an object of a store to a single object.
+  * @param store The store of the fused objects.
+  * @param index The index of the object in the store.
+  * @param fusedObject The object to be filled.
+  * @return Void.
+  */
+void GetFusedObject(const FusedObjectStore_t* store, const u8_t index, FusedObject_t* fusedObject);
+
+/**
+  * @brief Scatters a single object to the fields of an object of a store.
+  * @param store The store of the fused objects.
+  * @param index The index of the object in the store.
+  * @param fusedObject The object to be stored.
+  * @return Void.
+  */
+void SetFusedObject(FusedObjectStore_t* store, const u8_t index, const FusedObject_t* fusedObject);
+
+/*****************************************************************************/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* FUSED_OBJECT_STORE_H */
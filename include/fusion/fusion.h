@@ -31,16 +31,28 @@ extern "C" {
 /**
   * @brief Initializes the fusion algorithm.
   * @details All the lists are reset and the tracker is initialized.
+  * @param config The capacities of the algorithm (each within its maximum).
   * @return Void.
   */ 
-void InitializeFusion(void);
+void InitializeFusion(const AlgorithmConfig_t* config);
     
 /**
   * @brief Runs the algorithm for one cycle.
   * @details The three steps of the algo (predict, update, manage) are executed.
+  * @param prefusedObjectList A list containing the prefused objects (input of algo).
+  * @param numPrefusedObjects The number of prefused objects (at the front of the list).
+  * @param fusedObjectStore The store of the fused objects (output of algo).
+  * @param dt The time step since the previous cycle.
   * @return Void.
   */ 
-void RunFusion(const PrefusedObject_t* prefusedObjectList, FusedObject_t* fusedObjectList);
+void RunFusion(const PrefusedObject_t* prefusedObjectList, const u8_t numPrefusedObjects, FusedObjectStore_t* fusedObjectStore, const real_t dt);
+
+/**
+  * @brief Gets the cost of the association of the last cycle.
+  * @param stats The time of the update step (in s) and the clusters, hypotheses and fallbacks of the JPDA association mode.
+  * @return Void.
+  */
+void GetAssociationStats(AssociationStats_t* stats);
 
 /*****************************************************************************/
 
@@ -29,10 +29,10 @@ extern "C" {
 /***************************** Macro Definitions *****************************/
 
 /** Convert degrees to radians. */
-#define DEG2RAD(x) (0.017453292519943f * (x))
+#define DEG2RAD(x) ((real_t)0.017453292519943 * (x))
 
 /** Convert radians to degrees. */
-#define RAD2DEG(x) (57.295779513082323f * (x))
+#define RAD2DEG(x) ((real_t)57.295779513082323 * (x))
 
 /***************************** Static Functions ******************************/
 
@@ -40,9 +40,11 @@ extern "C" {
   * @brief Initialize the algo_util module.
   * @details All static variables (e.g. gating weights) are initialized
   *          according to the parameters.
+  *          New objects are only given the slots and the IDs within the capacities of the configuration.
+  * @param config The capacities of the algorithm (each within its maximum).
   * @return Void.
   */
-void InitializeFusionUtils(void);
+void InitializeFusionUtils(const AlgorithmConfig_t* config);
 
 /**
   * @brief Get a priority value for an object.
@@ -52,7 +54,7 @@ void InitializeFusionUtils(void);
   * @param target_y The y position of the object.
   * @return The priority value that was calculated.
   */
-f32_t GetObjectPriority(const f32_t posX, const f32_t posY);
+real_t GetObjectPriority(const real_t posX, const real_t posY);
    
 /**
   * @brief Creates a prefused object using the information of an input object.
@@ -66,33 +68,122 @@ f32_t GetObjectPriority(const f32_t posX, const f32_t posY);
   * @param vy The velocity y of the input object.
   * @return Void.
   */
-void CreatePrefusedObject(PrefusedObject_t* prefusedObject, const Sensor_t* pSensor, f32_t posX, f32_t posY, f32_t velX, f32_t velY);
+void CreatePrefusedObject(PrefusedObject_t* prefusedObject, const Sensor_t* pSensor, real_t posX, real_t posY, real_t velX, real_t velY);
 
 /**
   * @brief Tries to associate a prefused object with the current fused object list.
   * @details The prefused object passes an acceptance gate to determine if it will be fused
   *          with a neighbor or not. If no associationg (pairing) is made, the a new object will be created.
-  * @param prefusedObject A prefused object used as an input to the algo.
-  * @param fusedObjectList A list containing the fused objects (output of algo).
+  *          If the sensor object ID of the prefused object was associated with a fused object before (a hint),
+  *          only the gate of that object is checked first, and all the neighbors are searched only if the hinted gate fails.
+  *          The prefused objects must have been gated by `GatePrefusedObjects`.
+  * @param prefusedObjectList A list containing the prefused objects (input of algo).
+  * @param index The index of the prefused object to be associated.
+  * @param fusedObjectStore The store of the fused objects (output of algo).
+  * @return Void.
+  */
+void AssociatePrefusedObject(const PrefusedObject_t* prefusedObjectList, const u8_t index, FusedObjectStore_t* fusedObjectStore);
+
+/**
+  * @brief Associates the prefused objects of a sensor with the current fused object list at once (global nearest neighbour).
+  * @details The gating values of all the prefused objects of the sensor against the fused objects inside their acceptance gates
+  *          form the cost matrix of an assignment problem, with a dummy column per prefused object for leaving it unpaired.
+  *          The paired prefused objects are fused first, then a new object is created from each unpaired one.
+  *          The prefused objects must have been gated by `GatePrefusedObjects`.
+  * @param prefusedObjectList A list containing the prefused objects (input of algo).
+  * @param numPrefusedObjects The number of prefused objects (at the front of the list).
+  * @param sensorId The index of the sensor whose prefused objects are associated.
+  * @param fusedObjectStore The store of the fused objects (output of algo).
   * @return Void.
   */
-void AssociatePrefusedObject(const PrefusedObject_t* prefusedObject, FusedObject_t* fusedObjectList);
+void AssociateSensorObjects(const PrefusedObject_t* prefusedObjectList, const u8_t numPrefusedObjects, const u8_t sensorId, FusedObjectStore_t* fusedObjectStore);
+
+/**
+  * @brief Associates the prefused objects of a sensor with the current fused object list in probability (JPDA).
+  * @details The cost matrix is built as in `AssociateSensorObjects`, and split into clusters of prefused objects that share fused objects.
+  *          Each fused object is fused with the merge of its gated prefused objects, weighted by their marginal probabilities.
+  *          Then, a new object is created from each prefused object whose most probable option is not being paired.
+  *          A cluster with more than `JPDA_MAX_HYPOTHESES` hypotheses is associated as in `AssociateSensorObjects` instead.
+  *          The prefused objects must have been gated by `GatePrefusedObjects`.
+  * @param prefusedObjectList A list containing the prefused objects (input of algo).
+  * @param numPrefusedObjects The number of prefused objects (at the front of the list).
+  * @param sensorId The index of the sensor whose prefused objects are associated.
+  * @param fusedObjectStore The store of the fused objects (output of algo).
+  * @param stats The clusters, hypotheses and fallbacks are added to the statistics.
+  * @return Void.
+  */
+void AssociateSensorHypotheses(const PrefusedObject_t* prefusedObjectList, const u8_t numPrefusedObjects, const u8_t sensorId, FusedObjectStore_t* fusedObjectStore,
+                               AssociationStats_t* stats);
+
+/**
+  * @brief Builds the grid that the acceptance gate finds its candidate objects with.
+  * @details Must be called after the fused objects are predicted and before they are associated.
+  *          The grid is kept up to date when an object is created or fused during the update step.
+  * @param fusedObjectStore The store of the fused objects (output of algo).
+  * @return Void.
+  */
+void BuildTrackGrid(const FusedObjectStore_t* fusedObjectStore);
+
+/**
+  * @brief Builds the heap that the worst priority object is evicted with, when a new object finds the list full.
+  * @details Must be called after the priorities of the fused objects are updated and before they are associated.
+  *          The heap is kept up to date when an object is created or replaced during the update step.
+  * @param fusedObjectStore The store of the fused objects (output of algo).
+  * @return Void.
+  */
+void BuildEvictionHeap(const FusedObjectStore_t* fusedObjectStore);
+
+/**
+  * @brief Gates all the prefused objects against the predicted fused objects, the plots of each sensor in parallel.
+  * @details Must be called after the grid is built and before the prefused objects are associated.
+  *          The association then merges the prefused objects in the fixed order of the list (or of the sensors),
+  *          recalculating only the gating values of the objects that the prefused objects merged before have changed,
+  *          so that the result is bit-identical to gating each prefused object when it is associated.
+  *          In the greedy association mode, the prefused objects with an association hint are gated only if the hint fails.
+  * @param prefusedObjectList A list containing the prefused objects (input of algo).
+  * @param numPrefusedObjects The number of prefused objects (at the front of the list).
+  * @return Void.
+  */
+void GatePrefusedObjects(const PrefusedObject_t* prefusedObjectList, const u8_t numPrefusedObjects);
+
+/**
+  * @brief Fuses the plots accumulated for each fused object during the cycle.
+  * @details Only used by the information update mode, where `AssociatePrefusedObject` accumulates
+  *          the paired plots instead of fusing them. The accumulated information is cleared afterwards.
+  * @param fusedObjectStore The store of the fused objects (output of algo).
+  * @return Void.
+  */
+void FuseAccumulatedPlots(FusedObjectStore_t* fusedObjectStore);
 
 /**
   * @brief Checks if two fused objects are very close and should be pruned.
   * @details Each state (pos/vel) of each object is compared with the other object's state.
   *          If all the states are below a user-defined limit, the object with the lowest priority is pruned (deleted).
-  *          This function is similar with the `GetGatingValue` where the similarity of two objects is found.
+  *          This function is similar with the `GetGatingValues` where the similarity of two objects is found.
   *          The difference is that the gating function takes a probabilistic approach, while this one takes
   *          a more intuitive (to the user) approach. Also, the gating function compares a track and a plot,
   *          while this function compares two tracks. This way, a maintainance to all the objects is performed
   *          to find double objects that might have occurred after the fusion.
-  * @param fusedObject1 The first fusedObject to be checked for pruning.
-  * @param fusedObject2 The second fusedObject to be checked for pruning.
+  * @param fusedObjectStore The store of the fused objects (output of algo).
+  * @param index1 The index of the first fused object to be checked for pruning.
+  * @param index2 The index of the second fused object to be checked for pruning.
   * @todo Account also for the objects' lifetime.
   * @return Void.
   */
-void CheckObjectsForPruning(FusedObject_t* fusedObject1, FusedObject_t* fusedObject2);
+void CheckObjectsForPruning(FusedObjectStore_t* fusedObjectStore, const u8_t index1, const u8_t index2);
+
+/**
+  * @brief Prunes the fused objects that are very close to another object.
+  * @details Same as calling `CheckObjectsForPruning` for every pair of valid objects in index order,
+  *          but only the pairs that are within `PRUNE_LIMIT_X` are checked. The valid objects are sorted by x (in O(N log N))
+  *          and swept, so that each object is only compared with the objects that follow it inside the window.
+  *          Each pair found is marked in a bitmap of the higher indices kept per lower index, and the bitmaps are then
+  *          walked in index order, skipping the pairs with an already pruned object. This gives the same pruning decisions
+  *          as the check of all the pairs, in O(N log N + K) for K pairs in the window.
+  * @param fusedObjectStore The store of the fused objects (output of algo).
+  * @return Void.
+  */
+void PruneObjects(FusedObjectStore_t* fusedObjectStore);
 
 /**
   * @brief Performs maintenance on a single fused object.
@@ -100,21 +191,23 @@ void CheckObjectsForPruning(FusedObject_t* fusedObject1, FusedObject_t* fusedObj
   *          In case the oject was lost (not seen by any sensor), its lost counter is increased.
   *          If the lost counter is bigger than the user-defined coasting cycles, the object will be killed.
   *          Otherwise, the object will live and be outputted and on the next cycle it will be predicted (coasted).
-  * @param fusedObject A fused object that is outputted from the algo.
+  * @param fusedObjectStore The store of the fused objects (output of algo).
+  * @param index The index of the object in the fused object store.
   * @return Void.
   */
-void MaintainObject(FusedObject_t* fusedObject);
+void MaintainObject(FusedObjectStore_t* fusedObjectStore, const u8_t index);
 
 /**
   * @brief Checks if a fused object is ready to be outputted.
   * @details If a fused object (tentative from the point of view of the interface) is valid
   *          and has lived long enough (user-defined parameter) it is confirmed.
-  * @param fusedObject A fused object that is outputted from the algo.
+  * @param fusedObjectStore The store of the fused objects (output of algo).
+  * @param index The index of the object in the fused object store.
   * @todo Refactor to return expression.
   * @todo Use M of N rule to confirm.
   * @return Whether the object is confirmed or not.
   */
-u8_t IsTentativeObjectConfirmed(const FusedObject_t* fusedObject);
+u8_t IsTentativeObjectConfirmed(const FusedObjectStore_t* fusedObjectStore, const u8_t index);
 
 /*****************************************************************************/
 
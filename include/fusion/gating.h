@@ -0,0 +1,98 @@
+/*
+ * Copyright (C) 2016 Dimitris Geromichalos
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef GATING_H
+#define GATING_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************** Inclusions *********************************/
+
+#include "algorithm_types.h"
+
+/***************************** Public Functions ******************************/
+
+/**
+  * @brief Copies the means and the variances of a track to its lane of the gating tracks.
+  * @details The acceptance interval of the position in each axis is also precomputed. Its half width is the distance where
+  *          the similarity of the state would reach `STATE_GATING_VALUE_MIN_LIMIT` with a zero plot variance.
+  * @param tracks The gating tracks.
+  * @param index The index of the track's object in the fused object list.
+  * @param X The mean of the track.
+  * @param variance The variance of each state of the track.
+  * @param weights The gating weight of each state.
+  * @return Void.
+  */
+void SetGatingTrack(GatingTracks_t* tracks, const u8_t index, const real_t* X, const real_t* variance, const real_t* weights);
+
+/**
+  * @brief Calculates the gating values between a plot and all the gating tracks.
+  * @details Same as summing `GetSimilarityValue` * weight over the states, where a state at or below
+  *          `STATE_GATING_VALUE_MIN_LIMIT` gives `INVALID_GATING_VALUE` for the track.
+  *          The gate of each state is checked with multiplications only (weight * (varPlot + varTrack) > limit * dist^2)
+  *          and each similarity takes a single reciprocal, without branches, so that the tracks are processed lane-parallel.
+  *          The values match the ones of `GetSimilarityValue` up to rounding.
+  *          First, the position intervals of the plot and the tracks are compared (a pre-gate), which needs no arithmetic per track.
+  *          Since sqrt(a + b) <= sqrt(a) + sqrt(b), a pair whose intervals do not overlap in an axis can not pass the gate,
+  *          so that the similarities are skipped for a block of `VECTOR_LANES` tracks when none of them is inside the pre-gate.
+  * @param tracks The gating tracks.
+  * @param plot The plot to be gated.
+  * @param weights The gating weight of each state.
+  * @param gatingValues The gating value of each track (`NUM_BATCH_TRACKS` elements).
+  * @return Void.
+  */
+void GetGatingValues(const GatingTracks_t* tracks, const Plot_t* plot, const real_t* weights, real_t* gatingValues);
+
+/**
+  * @brief Calculates the gating value between a plot and a single gating track.
+  * @param tracks The gating tracks.
+  * @param index The index of the track.
+  * @param plot The plot to be gated.
+  * @param weights The gating weight of each state.
+  * @return The gating value, bit-identical to the lane of the track in `GetGatingValues`.
+  */
+real_t GetGatingValue(const GatingTracks_t* tracks, const u8_t index, const Plot_t* plot, const real_t* weights);
+
+/**
+  * @brief Unmarks all the changed gating tracks.
+  * @details Called once gating values have been computed, so that only the tracks set afterwards are marked.
+  * @param tracks The gating tracks.
+  * @return Void.
+  */
+void ClearGatingChanges(GatingTracks_t* tracks);
+
+/**
+  * @brief Recalculates the gating values of a plot for the gating tracks changed since the changes were cleared.
+  * @details Each changed track is gated alone, with the same operations in the same order as `GetGatingValues`,
+  *          so that the values are bit-identical to gating the plot against all the tracks again.
+  * @param tracks The gating tracks.
+  * @param plot The plot to be gated.
+  * @param weights The gating weight of each state.
+  * @param gatingValues The gating value of each track (`NUM_BATCH_TRACKS` elements), computed before the changes.
+  * @return Void.
+  */
+void UpdateGatingValues(const GatingTracks_t* tracks, const Plot_t* plot, const real_t* weights, real_t* gatingValues);
+
+/*****************************************************************************/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* GATING_H */
@@ -0,0 +1,64 @@
+/*
+ * Copyright (C) 2016 Dimitris Geromichalos
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef GATING_WORKERS_H
+#define GATING_WORKERS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************** Inclusions *********************************/
+
+#include "algorithm_types.h"
+
+/***************************** Public Functions ******************************/
+
+/**
+  * @brief Calculates the gating values between each prefused object to be gated and all the gating tracks.
+  * @details The plots of each sensor (by its index, modulo the number of threads) are gated by one of `GATING_WORKERS` persistent worker threads or by the calling thread,
+  *          all at the same time. The call returns when all the plots are gated.
+  *          Each plot is gated by `GetGatingValues` alone, so that the values do not depend on the thread or the timing.
+  *          Waking and joining the workers costs microseconds per call, so that they pay off only when a cycle gates many plots.
+  *          The workers are started by the first call and inherit the scheduling policy of the calling thread.
+  *          If a worker can not be started, its sensors are gated by the calling thread.
+  * @param tracks The gating tracks, which must not change until the call returns.
+  * @param prefusedObjectList The prefused objects used as an input to the algo.
+  * @param numPrefusedObjects The number of prefused objects (at the front of the list).
+  * @param gatePlot Whether each prefused object is gated (the gating values of the rest are left as they are).
+  * @param weights The gating weight of each state.
+  * @param gatingValues The gating values of each prefused object (`NUM_BATCH_TRACKS` elements per object).
+  * @return Void.
+  */
+void GetPlotGatingValues(const GatingTracks_t* tracks, const PrefusedObject_t* prefusedObjectList, const u8_t numPrefusedObjects, const u8_t* gatePlot,
+                         const real_t* weights, real_t (*gatingValues)[NUM_BATCH_TRACKS]);
+
+/**
+  * @brief Gets the number of plots gated by a share of the last call of `GetPlotGatingValues`.
+  * @details The share zero is the calling thread and the share n is the worker n.
+  * @param share The share (0 to `GATING_WORKERS`).
+  * @return The number of plots gated by the share (0 for any other share).
+  */
+u8_t GetShareGatedPlots(const u8_t share);
+
+/*****************************************************************************/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* GATING_WORKERS_H */
@@ -0,0 +1,63 @@
+/*
+ * Copyright (C) 2016 Dimitris Geromichalos
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ID_ALLOCATOR_H
+#define ID_ALLOCATOR_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************** Inclusions *********************************/
+
+#include "algorithm_types.h"
+
+/***************************** Public Functions ******************************/
+
+/**
+  * @brief Marks all the IDs below a max ID as available.
+  * @param allocator The allocator to be reset.
+  * @param maxId The IDs in use are below it (at most `MAX_ID`).
+  * @return Void.
+  */
+void ResetIdAllocator(IdAllocator_t* allocator, const ObjectId_t maxId);
+
+/**
+  * @brief Allocates the lowest available ID.
+  * @details The first word of the bitmap that is not full is found and its first zero bit is taken,
+  *          so that the cost does not depend on the number of objects (one word for up to 32 IDs).
+  * @param allocator The allocator to allocate from.
+  * @return The allocated ID, or `INVALID_ID` if all the IDs are used.
+  */
+ObjectId_t AllocateId(IdAllocator_t* allocator);
+
+/**
+  * @brief Makes an ID available again.
+  * @details No action is taken for the invalid ID.
+  * @param allocator The allocator that the ID was allocated from.
+  * @param id The ID to be freed.
+  * @return Void.
+  */
+void FreeId(IdAllocator_t* allocator, const ObjectId_t id);
+
+/*****************************************************************************/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* ID_ALLOCATOR_H */
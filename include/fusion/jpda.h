@@ -0,0 +1,58 @@
+/*
+ * Copyright (C) 2016 Dimitris Geromichalos
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef JPDA_H
+#define JPDA_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************** Inclusions *********************************/
+
+#include "algorithm_types.h"
+
+/***************************** Public Functions ******************************/
+
+/**
+  * @brief Calculates the marginal association probabilities of the rows of an assignment problem (JPDA).
+  * @details A pair is gated if its cost is below `DUMMY_ASSIGNMENT_COST`, its likelihood being the negated cost.
+  *          The rows that share gated columns, directly or through other rows, form a cluster (union-find).
+  *          The joint hypotheses (each row paired with a different gated column, or not paired) are enumerated
+  *          inside each cluster only, each weighted by the product of the likelihoods of its rows.
+  *          The marginal of a pair is the normalized sum of the weights of the hypotheses that contain it
+  *          (`marginal[row][col]`, `marginal[row][JPDA_NONE_COL]` for not being paired).
+  *          A cluster with more than the max hypotheses is abandoned: its rows are flagged (`fallback[row]`)
+  *          and must be associated otherwise (e.g. with `SolveAssignment`, whose optimum decomposes over the clusters).
+  * @param workspace The workspace that holds the results and the scratch buffers.
+  * @param cost The cost matrix of the assignment problem (the first `NUM_FUSED_OBJ` columns are read).
+  * @param rows The number of rows (up to `MAX_ASSIGNMENT_ROWS`).
+  * @param noneLikelihood The likelihood of a row not being paired.
+  * @param maxHypotheses The max number of hypotheses of a cluster.
+  * @param stats The clusters, hypotheses and fallbacks are added to the statistics.
+  * @return Void.
+  */
+void SolveJpda(JpdaWorkspace_t* workspace, const real_t (*cost)[MAX_ASSIGNMENT_COLS], const u8_t rows,
+               const real_t noneLikelihood, const u32_t maxHypotheses, AssociationStats_t* stats);
+
+/*****************************************************************************/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* JPDA_H */
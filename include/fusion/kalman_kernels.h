@@ -0,0 +1,310 @@
+/*
+ * Copyright (C) 2016 Dimitris Geromichalos
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef KALMAN_KERNELS_H
+#define KALMAN_KERNELS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************** Inclusions *********************************/
+
+#include <string.h>
+
+#include "common_types.h"
+#include "algorithm_types.h"
+
+/***************************** Macro Definitions *****************************/
+
+/**
+  * Requests the complete unrolling of the following loop.
+  * Combined with a constant dimension, every loop of a kernel becomes straight-line code
+  * and every `GET_UPPER_INDEX` is folded to a constant.
+  */
+#if defined(__GNUC__) && (__GNUC__ >= 8)
+#define KALMAN_UNROLL _Pragma("GCC unroll 64")
+#else
+#define KALMAN_UNROLL
+#endif
+
+/**
+  * @brief Defines the Kalman kernels specialized for a state dimension.
+  * @details The kernels are defined as static inline functions with the dimension as a suffix
+  *          (e.g. `ComposeUD4`, `DecomposeUD4`, `EstimateCovariance4`, `FuseState4` and `FuseUnitStates4` for N = 4).
+  *          Their arguments are the same as the ones of the generic functions of `kalman_utils.h`,
+  *          apart from the scratch matrices of `EstimateCovariance`, which are passed one by one.
+  *          The operations of `ComposeUD`, `DecomposeUD`, `EstimateCovariance` and `FuseState` are performed in the same order
+  *          as the generic loops, so their results are identical. `FuseUnitStates` still walks the UD factors once per state,
+  *          but skips the zero terms of the unit transformation, so it only matches the generic loop up to rounding.
+  *          The functions of `kalman_utils.h` use the kernels of `KALMAN_STATES`,
+  *          unless `KALMAN_GENERIC_KERNELS` is defined.
+  * @param N The dimension of the state (a literal constant).
+  */
+#define DEFINE_KALMAN_KERNELS(N) \
+\
+static inline void ComposeUD##N(const real_t* U, const real_t* D, real_t* UDU) \
+{ \
+    u8_t i, j, k; \
+    real_t sigma; \
+\
+    KALMAN_UNROLL \
+    for (i = 0u; i < (N); i++) \
+    { \
+        KALMAN_UNROLL \
+        for (j = i; j < (N); j++) \
+        { \
+            sigma = 0.f; \
+\
+            KALMAN_UNROLL \
+            for (k = j; k < (N); k++) \
+            { \
+                sigma += U[GET_UPPER_INDEX(j, k, (N))] * (D[k] * U[GET_UPPER_INDEX(i, k, (N))]); \
+            } \
+\
+            UDU[((N) * i) + j] = sigma; \
+            UDU[((N) * j) + i] = sigma; \
+        } \
+    } \
+} \
+\
+static inline void DecomposeUD##N(const real_t* UDU, real_t* U, real_t* D) \
+{ \
+    u8_t i, j, k, ri, rj; \
+    real_t sigma; \
+\
+    KALMAN_UNROLL \
+    for (rj = 0u; rj < (N); rj++) \
+    { \
+        j = ((N) - 1u) - rj; \
+\
+        KALMAN_UNROLL \
+        for (ri = rj; ri < (N); ri++) \
+        { \
+            i = ((N) - 1u) - ri; \
+            sigma = UDU[((N) * i) + j]; \
+\
+            KALMAN_UNROLL \
+            for (k = j + 1u; k < (N); k++) \
+            { \
+                sigma += -U[GET_UPPER_INDEX(i, k, (N))] * D[k] * U[GET_UPPER_INDEX(j, k, (N))]; \
+            } \
+\
+            if (i == j) \
+            { \
+                D[j] = sigma; \
+                U[GET_UPPER_INDEX(j, j, (N))] = 1.0f; \
+            } \
+            else \
+            { \
+                U[GET_UPPER_INDEX(i, j, (N))] = sigma / D[j]; \
+            } \
+        } \
+    } \
+} \
+\
+static inline void EstimateCovariance##N(const real_t* inputF, const real_t* inputQu, const real_t* inputQd, \
+    real_t* outputQu, real_t* outputQd, real_t* F, real_t* Qu, real_t* Qd) \
+{ \
+    u8_t i, j, k, ri; \
+    real_t sigma; \
+\
+    (void)memcpy(Qu, inputQu, GET_BYTE_UPPER(N)); \
+\
+    KALMAN_UNROLL \
+    for (i = 0u; i < (N); i++) \
+    { \
+        KALMAN_UNROLL \
+        for (j = 0u; j < (N); j++) \
+        { \
+            sigma = inputF[((N) * i) + j]; \
+\
+            KALMAN_UNROLL \
+            for (k = 0u; k < j; k++) \
+            { \
+                sigma += inputF[((N) * i) + k] * outputQu[GET_UPPER_INDEX(k, j, (N))]; \
+            } \
+\
+            F[((N) * i) + j] = sigma; \
+        } \
+    } \
+\
+    KALMAN_UNROLL \
+    for (ri = 0u; ri < (N); ri++) \
+    { \
+        i = ((N) - 1u) - ri; \
+        sigma = 0.f; \
+\
+        KALMAN_UNROLL \
+        for (j = 0u; j < (N); j++) \
+        { \
+            sigma += F[((N) * i) + j] * F[((N) * i) + j] * outputQd[j]; \
+\
+            if (i <= j) \
+            { \
+                sigma += Qu[GET_UPPER_INDEX(i, j, (N))] * Qu[GET_UPPER_INDEX(i, j, (N))] * inputQd[j]; \
+            } \
+        } \
+\
+        Qd[i] = sigma; \
+\
+        KALMAN_UNROLL \
+        for (j = 0u; j < i; j++) \
+        { \
+            sigma = 0.0f; \
+\
+            KALMAN_UNROLL \
+            for (k = 0u; k < (N); k++) \
+            { \
+                sigma += F[((N) * i) + k] * outputQd[k] * F[((N) * j) + k]; \
+\
+                if ((i <= k) && (j <= k)) \
+                { \
+                    sigma += Qu[GET_UPPER_INDEX(i, k, (N))] * inputQd[k] * Qu[GET_UPPER_INDEX(j, k, (N))]; \
+                } \
+            } \
+\
+            outputQu[GET_UPPER_INDEX(j, i, (N))] = sigma / Qd[i]; \
+\
+            KALMAN_UNROLL \
+            for (k = 0u; k < (N); k++) \
+            { \
+                F[((N) * j) + k] += -outputQu[GET_UPPER_INDEX(j, i, (N))] * F[((N) * i) + k]; \
+\
+                if ((i <= k) && (j <= k)) \
+                { \
+                    Qu[GET_UPPER_INDEX(j, k, (N))] += -outputQu[GET_UPPER_INDEX(j, i, (N))] * Qu[GET_UPPER_INDEX(i, k, (N))]; \
+                } \
+            } \
+        } \
+    } \
+\
+    (void)memcpy(outputQd, Qd, sizeof(real_t) * (N)); \
+} \
+\
+static inline void FuseState##N(const real_t innovation, const real_t alpha, const real_t* transformation, \
+    real_t* state, real_t* outputQu, real_t* outputQd) \
+{ \
+    u8_t i, j; \
+    real_t beta, lambda, gamma, scaledInnovation; \
+    real_t tempAlpha = alpha; \
+    real_t tempVector1[(N)]; \
+    real_t tempVector2[(N)]; \
+\
+    gamma = 1.f / tempAlpha; \
+\
+    KALMAN_UNROLL \
+    for (j = 0u; j < (N); j++) \
+    { \
+        tempVector1[j] = transformation[j]; \
+\
+        KALMAN_UNROLL \
+        for (i = 0u; i < j; i++) \
+        { \
+            tempVector1[j] += outputQu[GET_UPPER_INDEX(i, j, (N))] * transformation[i]; \
+        } \
+\
+        tempVector2[j] = outputQd[j] * tempVector1[j]; \
+    } \
+\
+    KALMAN_UNROLL \
+    for (j = 0u; j < (N); j++) \
+    { \
+        beta = tempAlpha; \
+        tempAlpha += tempVector1[j] * tempVector2[j]; \
+        lambda = -tempVector1[j] * gamma; \
+        gamma = 1.0f / tempAlpha; \
+        outputQd[j] *= beta * gamma; \
+\
+        KALMAN_UNROLL \
+        for (i = 0u; i < j; i++) \
+        { \
+            beta = outputQu[GET_UPPER_INDEX(i, j, (N))]; \
+            outputQu[GET_UPPER_INDEX(i, j, (N))] = beta + (tempVector2[i] * lambda); \
+            tempVector2[i] += tempVector2[j] * beta; \
+        } \
+    } \
+\
+    scaledInnovation = gamma * innovation; \
+\
+    KALMAN_UNROLL \
+    for (j = 0u; j < (N); j++) \
+    { \
+        state[j] += scaledInnovation * tempVector2[j]; \
+    } \
+} \
+\
+static inline void FuseUnitStates##N(const real_t* measurement, const real_t* noise, const real_t weight, \
+    real_t* state, real_t* outputQu, real_t* outputQd) \
+{ \
+    u8_t i, j, m; \
+    real_t alpha, beta, lambda, gamma, scaledInnovation, transformation; \
+    real_t tempVector[(N)]; \
+\
+    KALMAN_UNROLL \
+    for (m = 0u; m < (N); m++) \
+    { \
+        alpha = noise[m]; \
+        gamma = 1.f / alpha; \
+        scaledInnovation = (measurement[m] - state[m]) * weight; \
+\
+        KALMAN_UNROLL \
+        for (i = 0u; i < m; i++) \
+        { \
+            tempVector[i] = 0.f; \
+        } \
+\
+        /* The transformation is zero before the measured state, so the walk starts from it. */ \
+        KALMAN_UNROLL \
+        for (j = m; j < (N); j++) \
+        { \
+            transformation = (j == m) ? 1.f : outputQu[GET_UPPER_INDEX(m, j, (N))]; \
+            tempVector[j] = outputQd[j] * transformation; \
+\
+            beta = alpha; \
+            alpha += transformation * tempVector[j]; \
+            lambda = -transformation * gamma; \
+            gamma = 1.0f / alpha; \
+            outputQd[j] *= beta * gamma; \
+\
+            KALMAN_UNROLL \
+            for (i = 0u; i < j; i++) \
+            { \
+                beta = outputQu[GET_UPPER_INDEX(i, j, (N))]; \
+                outputQu[GET_UPPER_INDEX(i, j, (N))] = beta + (tempVector[i] * lambda); \
+                tempVector[i] += tempVector[j] * beta; \
+            } \
+        } \
+\
+        scaledInnovation *= gamma; \
+\
+        KALMAN_UNROLL \
+        for (j = 0u; j < (N); j++) \
+        { \
+            state[j] += scaledInnovation * tempVector[j]; \
+        } \
+    } \
+}
+
+/*****************************************************************************/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* KALMAN_KERNELS_H */
@@ -25,6 +25,8 @@ extern "C" {
 /******************************** Inclusions *********************************/
 
 #include "common_types.h"
+#include "algorithm_types.h"
+#include "vector_types.h"
 
 /***************************** Public Functions ******************************/
 
@@ -35,7 +37,18 @@ extern "C" {
   * @param UDU The UDU matrix.
   * @return Void.
   */
-void ComposeUD(const f32_t* U, const f32_t* D, f32_t* UDU);
+void ComposeUD(const real_t* U, const real_t* D, real_t* UDU);
+
+/**
+  * @brief Composes only the diagonal of the UDU matrix given the U and D matrices.
+  * @details Each variance is computed directly from the factors as the sum of U(i,k)^2 * D(k) for k >= i,
+  *          so the full matrix does not have to be composed when only the variances are needed.
+  * @param U The upper triangular matrix.
+  * @param D The diagonal matrix.
+  * @param V The diagonal of the UDU matrix.
+  * @return Void.
+  */
+void ComposeDiagonalUD(const real_t* U, const real_t* D, real_t* V);
 
 /**
   * @brief Computes the UD decomposition given a UDU matrix.
@@ -44,7 +57,7 @@ void ComposeUD(const f32_t* U, const f32_t* D, f32_t* UDU);
   * @param D The diagonal matrix.
   * @return Void.
   */
-void DecomposeUD(const f32_t* UDU, f32_t* U, f32_t* D);
+void DecomposeUD(const real_t* UDU, real_t* U, real_t* D);
 
 /**
   * @brief Predicts the state vector given the state transition matrix.
@@ -52,7 +65,7 @@ void DecomposeUD(const f32_t* UDU, f32_t* U, f32_t* D);
   * @param state The state vector.
   * @return Void.
   */
-void PredictState(const f32_t* inputF, f32_t* state);
+void PredictState(const real_t* inputF, real_t* state);
 
 /**
   * @brief Fuses a measurement with the state and calculate the UD decomposition of the state covariance matrix.
@@ -64,7 +77,23 @@ void PredictState(const f32_t* inputF, f32_t* state);
   * @param outputQd The diagonal matrix of the UD factor.
   * @return Void.
   */
-void FuseState(const f32_t innovation, const f32_t alpha, const f32_t* transformation, f32_t* state, f32_t* outputQu, f32_t* outputQd);
+void FuseState(const real_t innovation, const real_t alpha, const real_t* transformation, real_t* state, real_t* outputQu, real_t* outputQd);
+
+/**
+  * @brief Fuses a measurement of all the states (unit transformation, diagonal noise) with the state.
+  * @details Equivalent to fusing each state in turn with `FuseState` and a unit transformation matrix (one triangular
+  *          walk of the UD factors per state), but the transformation is never materialized and the factors before each
+  *          measured state are not walked. The skipped terms are zero, so the result matches `FuseState` up to rounding.
+  *          The innovation of each state is computed from the state updated by the previous ones.
+  * @param measurement The measurement vector.
+  * @param noise The noise (diagonal of the covariance matrix) of the measurement.
+  * @param weight The weight that each innovation is scaled with.
+  * @param state The state vector.
+  * @param outputQu The upper triangular matrix of the UD factor.
+  * @param outputQd The diagonal matrix of the UD factor.
+  * @return Void.
+  */
+void FuseUnitStates(const real_t* measurement, const real_t* noise, const real_t weight, real_t* state, real_t* outputQu, real_t* outputQd);
 
 /**
   * @brief Estimates the UD decomposition of the covariance matrix of the predicted state.
@@ -73,9 +102,84 @@ void FuseState(const f32_t innovation, const f32_t alpha, const f32_t* transform
   * @param inputQd The input diagonal matrix of the UD factor.
   * @param outputQu The output upper triangular matrix of the UD factor.
   * @param outputQd The output diagonal matrix of the UD factor.
+  * @param workspace The scratch matrices of the caller.
+  * @return Void.
+  */
+void EstimateCovariance(const real_t* inputF, const real_t* inputQu, const real_t* inputQd, real_t* outputQu, real_t* outputQd, KalmanWorkspace_t* workspace);
+
+/**
+  * @brief Predicts the state and the covariance matrix of a decoupled (pos/vel) filter.
+  * @details The constant velocity model is applied in closed form, i.e. P = F * P * F' + Q
+  *          is expanded for F = [1 dt; 0 1], without any matrix operation.
+  * @param dt The time step of the prediction.
+  * @param inputQ The upper matrix of the noise covariance matrix of the axis.
+  * @param pos The position state of the axis.
+  * @param vel The velocity state of the axis.
+  * @param P The upper matrix of the covariance matrix of the axis.
+  * @return Void.
+  */
+void PredictAxis(const real_t dt, const real_t* inputQ, real_t* pos, real_t* vel, real_t* P);
+
+/**
+  * @brief Fuses a measurement of one state with a decoupled (pos/vel) filter.
+  * @details The scalar update is applied in closed form, since the transformation
+  *          matrix only selects the measured state (unit vector).
+  * @param innovation The measurement innovation.
+  * @param alpha The noise of the innovation.
+  * @param state The index of the measured state inside the axis (0 for pos, 1 for vel).
+  * @param pos The position state of the axis.
+  * @param vel The velocity state of the axis.
+  * @param P The upper matrix of the covariance matrix of the axis.
+  * @return Void.
+  */
+void FuseAxis(const real_t innovation, const real_t alpha, const u8_t state, real_t* pos, real_t* vel, real_t* P);
+
+#ifdef VECTOR_EXTENSIONS
+
+/**
+  * @brief Composes the diagonals of the UDU matrices of a block of lanes.
+  * @see `ComposeDiagonalUD`.
+  * @param U The upper triangular matrix (one vector per element).
+  * @param D The diagonal matrix (one vector per element).
+  * @param V The diagonal of the UDU matrix (one vector per element).
+  * @return Void.
+  */
+void ComposeDiagonalUDLanes(const vreal_t* U, const vreal_t* D, vreal_t* V);
+
+/**
+  * @brief Predicts the state vectors of a block of lanes, given a common state transition matrix.
+  * @see `PredictState`.
+  * @param inputF The state transition matrix.
+  * @param state The state vector (one vector per element).
   * @return Void.
   */
-void EstimateCovariance(const f32_t* inputF, const f32_t* inputQu, const f32_t* inputQd, f32_t* outputQu, f32_t* outputQd);
+void PredictStateLanes(const real_t* inputF, vreal_t* state);
+
+/**
+  * @brief Estimates the UD decomposition of the predicted covariance matrices of a block of lanes.
+  * @see `EstimateCovariance`.
+  * @param inputF The state transition matrix.
+  * @param inputQu The input upper triangular matrix of the UD factor of the noise.
+  * @param inputQd The input diagonal matrix of the UD factor of the noise.
+  * @param outputQu The upper triangular matrix of the UD factor (one vector per element).
+  * @param outputQd The diagonal matrix of the UD factor (one vector per element).
+  * @return Void.
+  */
+void EstimateCovarianceLanes(const real_t* inputF, const real_t* inputQu, const real_t* inputQd, vreal_t* outputQu, vreal_t* outputQd);
+
+/**
+  * @brief Predicts the states and the covariance matrices of the decoupled filters of a block of lanes.
+  * @see `PredictAxis`.
+  * @param dt The time step of the prediction.
+  * @param inputQ The upper matrix of the noise covariance matrix of the axis.
+  * @param pos The position states of the axis.
+  * @param vel The velocity states of the axis.
+  * @param P The upper matrix of the covariance matrix of the axis (one vector per element).
+  * @return Void.
+  */
+void PredictAxisLanes(const real_t dt, const real_t* inputQ, vreal_t* pos, vreal_t* vel, vreal_t* P);
+
+#endif
 
 /*****************************************************************************/
 
@@ -35,13 +35,19 @@ extern "C" {
 /**
   * @defgroup external_params External parameters
   * Parameters passed from platform to algorithm. 
+  * The fused objects may be raised at build time (up to 254, an index of a byte), e.g. to test large lists.
   *
   * @{
   */
 #define NUM_PREFUSED_OBJ (NUM_RX_OBJS)
+#ifndef NUM_FUSED_OBJ
 #define NUM_FUSED_OBJ    (NUM_TX_OBJS)
+#endif
 /** @} */
 
+/** The number of the object IDs a sensor can report (the IDs are below it). */
+#define NUM_SENSOR_OBJECT_IDS (((RX_FRONT_OBJECT_ID_MAX > RX_REAR_OBJECT_ID_MAX) ? RX_FRONT_OBJECT_ID_MAX : RX_REAR_OBJECT_ID_MAX) + 1u)
+
 /*****************************************************************************/
 
 #ifdef __cplusplus
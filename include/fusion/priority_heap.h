@@ -0,0 +1,89 @@
+/*
+ * Copyright (C) 2016 Dimitris Geromichalos
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIORITY_HEAP_H
+#define PRIORITY_HEAP_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************** Inclusions *********************************/
+
+#include "algorithm_types.h"
+
+/***************************** Public Functions ******************************/
+
+/**
+  * @brief Removes all the objects from a heap and marks the slots up to its capacity as free.
+  * @param heap The heap to be reset.
+  * @param capacity The number of slots of the fused object list in use (at most `NUM_FUSED_OBJ`).
+  * @return Void.
+  */
+void ResetPriorityHeap(PriorityHeap_t* heap, const u8_t capacity);
+
+/**
+  * @brief Builds a heap from the valid objects of the fused object list.
+  * @details Used after the priorities of all the objects are updated. The heap is built bottom-up in O(N).
+  *          The capacity that the heap was last reset with is kept.
+  * @param heap The heap to be built.
+  * @param fusedObjectStore The store of the fused objects (output of algo).
+  * @return Void.
+  */
+void BuildPriorityHeap(PriorityHeap_t* heap, const FusedObjectStore_t* fusedObjectStore);
+
+/**
+  * @brief Inserts an object to the heap and marks its slot as used.
+  * @param heap The heap that the object is inserted to.
+  * @param fusedObjectStore The store of the fused objects (output of algo).
+  * @param index The index of the object in the fused object list (must not be in the heap).
+  * @return Void.
+  */
+void InsertHeapObject(PriorityHeap_t* heap, const FusedObjectStore_t* fusedObjectStore, const u8_t index);
+
+/**
+  * @brief Removes an object from the heap and marks its slot as free.
+  * @details No action is taken if the object is not in the heap.
+  * @param heap The heap that the object is removed from.
+  * @param fusedObjectStore The store of the fused objects (output of algo).
+  * @param index The index of the object in the fused object list.
+  * @return Void.
+  */
+void RemoveHeapObject(PriorityHeap_t* heap, const FusedObjectStore_t* fusedObjectStore, const u8_t index);
+
+/**
+  * @brief Gets the object with the lowest priority.
+  * @details Among objects of equal priority, the one with the lowest index is returned.
+  * @param heap The heap.
+  * @return The index of the object in the fused object list, or `NUM_FUSED_OBJ` if the heap is empty.
+  */
+u8_t GetHeapMinObject(const PriorityHeap_t* heap);
+
+/**
+  * @brief Gets the first free slot of the fused object list.
+  * @param heap The heap.
+  * @return The index of the slot, or `NUM_FUSED_OBJ` if all the slots are used.
+  */
+u8_t GetHeapFreeSlot(const PriorityHeap_t* heap);
+
+/*****************************************************************************/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* PRIORITY_HEAP_H */
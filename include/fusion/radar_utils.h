@@ -34,7 +34,7 @@ extern "C" {
   * @param posY The y position of an object.
   * @return The calculated range.
   */
-f32_t GetRange(const f32_t posX, const f32_t posY);
+real_t GetRange(const real_t posX, const real_t posY);
 
 /**
   * @brief Calculates the bearing (angle) of an object.
@@ -42,7 +42,7 @@ f32_t GetRange(const f32_t posX, const f32_t posY);
   * @param posY The y position of an object.
   * @return The calculated bearing.
   */
-f32_t GetBearing(const f32_t posX, const f32_t posY);
+real_t GetBearing(const real_t posX, const real_t posY);
 
 /**
   * @brief Calculates the variance in x of an object from cartesian coordinates.
@@ -60,7 +60,7 @@ f32_t GetBearing(const f32_t posX, const f32_t posY);
   * @param baseVar The base (minimum) variance to be calculated.
   * @return The calculated variance.
   */
-f32_t GetVarX(const f32_t posX, const f32_t posY, const f32_t rangeVar, const f32_t bearingVar, const f32_t baseVar);
+real_t GetVarX(const real_t posX, const real_t posY, const real_t rangeVar, const real_t bearingVar, const real_t baseVar);
 
 /**
   * @brief Calculates the variance in y of an object from cartesian coordinates.
@@ -72,7 +72,7 @@ f32_t GetVarX(const f32_t posX, const f32_t posY, const f32_t rangeVar, const f3
   * @param baseVar The base (minimum) variance to be calculated.
   * @return The calculated variance.
   */
-f32_t GetVarY(const f32_t posX, const f32_t posY, const f32_t rangeVar, const f32_t bearingVar, const f32_t baseVar);
+real_t GetVarY(const real_t posX, const real_t posY, const real_t rangeVar, const real_t bearingVar, const real_t baseVar);
 
 /**
   * @brief Calculates the similarity between two distributions.
@@ -84,7 +84,7 @@ f32_t GetVarY(const f32_t posX, const f32_t posY, const f32_t rangeVar, const f3
   * @param variance2 The variance of the second distribution.
   * @return The calculated similarity value.
   */
-f32_t GetSimilarityValue(const f32_t mean1, const f32_t mean2, const f32_t variance1, const f32_t variance2);
+real_t GetSimilarityValue(const real_t mean1, const real_t mean2, const real_t variance1, const real_t variance2);
 
 /**
   * @brief Calculates the y coordinate of a point, given the x and the limits, using linear interpolation.
@@ -95,7 +95,7 @@ f32_t GetSimilarityValue(const f32_t mean1, const f32_t mean2, const f32_t varia
   * @param y2 The upper limit on the y axis.
   * @return The calculated y value.
   */
-f32_t GetLinInterpolatedValue(const f32_t x, const f32_t x1, const f32_t x2, const f32_t y1, const f32_t y2);
+real_t GetLinInterpolatedValue(const real_t x, const real_t x1, const real_t x2, const real_t y1, const real_t y2);
 
 /*****************************************************************************/
 
@@ -0,0 +1,88 @@
+/*
+ * Copyright (C) 2016 Dimitris Geromichalos
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef REAL_TYPES_H
+#define REAL_TYPES_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************** Inclusions *********************************/
+
+#include <math.h>
+
+#include "common_types.h"
+
+/***************************** Macro Definitions *****************************/
+
+/**
+  * @defgroup fusion_precisions The numeric precisions that can be selected for the fusion core
+  * F32: Single precision floating point (default).
+  * F64: Double precision floating point.
+  * There is no fixed-point precision: the gating, the polar conversions and the JPDA need a floating point type.
+  *
+  * @{
+  */
+#define FUSION_PRECISION_F32 (0u)
+#define FUSION_PRECISION_F64 (1u)
+/** @} */
+
+/** The precision used by the fusion core (can be overridden at build time). */
+#ifndef FUSION_PRECISION
+#define FUSION_PRECISION (FUSION_PRECISION_F32)
+#endif
+
+/**
+  * @defgroup real_math The math functions that match the selected precision
+  *
+  * @{
+  */
+#if (FUSION_PRECISION == FUSION_PRECISION_F64)
+#define REAL_SQRT(x)    (sqrt(x))
+#define REAL_ATAN2(y,x) (atan2((y), (x)))
+#define REAL_COS(x)     (cos(x))
+#define REAL_SIN(x)     (sin(x))
+#define REAL_FABS(x)    (fabs(x))
+#define REAL_FMAX(x,y)  (fmax((x), (y)))
+#else
+#define REAL_SQRT(x)    (sqrtf(x))
+#define REAL_ATAN2(y,x) (atan2f((y), (x)))
+#define REAL_COS(x)     (cosf(x))
+#define REAL_SIN(x)     (sinf(x))
+#define REAL_FABS(x)    (fabsf(x))
+#define REAL_FMAX(x,y)  (fmaxf((x), (y)))
+#endif
+/** @} */
+
+/***************************** Type Definitions ******************************/
+
+/** The real number type of the fusion core. */
+#if (FUSION_PRECISION == FUSION_PRECISION_F64)
+typedef f64_t real_t;
+#else
+typedef f32_t real_t;
+#endif
+
+/*****************************************************************************/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* REAL_TYPES_H */
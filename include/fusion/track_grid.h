@@ -0,0 +1,95 @@
+/*
+ * Copyright (C) 2016 Dimitris Geromichalos
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRACK_GRID_H
+#define TRACK_GRID_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************** Inclusions *********************************/
+
+#include "algorithm_types.h"
+
+/***************************** Public Functions ******************************/
+
+/**
+  * @brief Removes all the tracks from a grid.
+  * @param grid The grid to be reset.
+  * @return Void.
+  */
+void ResetTrackGrid(TrackGrid_t* grid);
+
+/**
+  * @brief Inserts a track to the grid.
+  * @details The track is chained to the bucket of the cell that contains its position,
+  *          and the max position variances of the grid are updated.
+  * @param grid The grid that the track is inserted to.
+  * @param index The index of the track's object in the fused object list (must not be in the grid).
+  * @param X The mean of the track.
+  * @param variance The variance of each state of the track.
+  * @return Void.
+  */
+void InsertGridTrack(TrackGrid_t* grid, const u8_t index, const real_t* X, const real_t* variance);
+
+/**
+  * @brief Moves a track of the grid to the bucket of its current position.
+  * @details Used after a track is fused. The max position variances are not updated,
+  *          since the variances of a track never grow when it is fused.
+  * @param grid The grid that the track is in.
+  * @param index The index of the track's object in the fused object list (inserted if not in the grid).
+  * @param X The mean of the track.
+  * @param variance The variance of each state of the track (used only if inserted).
+  * @return Void.
+  */
+void MoveGridTrack(TrackGrid_t* grid, const u8_t index, const real_t* X, const real_t* variance);
+
+/**
+  * @brief Removes a track from the grid.
+  * @details No action is taken if the track is not in the grid.
+  *          The max position variances are not decreased, so they remain an upper bound.
+  * @param grid The grid that the track is removed from.
+  * @param index The index of the track's object in the fused object list.
+  * @return Void.
+  */
+void RemoveGridTrack(TrackGrid_t* grid, const u8_t index);
+
+/**
+  * @brief Gets the tracks whose positions may be inside a box around a position.
+  * @details The half widths of the box are given squared, so that the square roots are only taken when the cells are searched.
+  *          The tracks of all the cells that overlap the box are returned (each once, in no particular order).
+  *          Tracks of other cells that share a bucket may also be returned.
+  *          If the grid holds up to `MIN_GRID_QUERY_TRACKS` tracks or the box covers more than `MAX_GRID_QUERY_CELLS` cells,
+  *          all the tracks of the grid are returned.
+  * @param grid The grid to be searched.
+  * @param posX The x position of the center of the box.
+  * @param posY The y position of the center of the box.
+  * @param radius2X The squared half width of the box in x.
+  * @param radius2Y The squared half width of the box in y.
+  * @param candidates The indices of the tracks found (at least `NUM_FUSED_OBJ` long).
+  * @return The number of the tracks found.
+  */
+u8_t GetGridCandidates(const TrackGrid_t* grid, const real_t posX, const real_t posY, const real_t radius2X, const real_t radius2Y, u8_t* candidates);
+
+/*****************************************************************************/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* TRACK_GRID_H */
@@ -31,12 +31,46 @@ extern "C" {
 
 /**
   * @brief Initializes the tracker of the algo.
-  * @details Initializes the process' state prediction and noise covariance matrices (F and Q).
-  *          A UD (Cholesky) decomposition is perfomed in Q, for use in the Kalman update step.
-  * @param dt The cycle time of the algo.
+  * @details The cache of the process models is reset and the process of the nominal cycle time is prepared.
+  * @param model The model to be initialized.
+  * @param dt The nominal cycle time of the algo.
   * @return Void.
   */
-void InitializeTracking(const f32_t dt);
+void InitializeTracking(TrackingModel_t* model, const real_t dt);
+
+/**
+  * @brief Gets the process model for a time step.
+  * @details The time step is quantized and looked up in the cache of the model.
+  *          On a miss, the process' state prediction and noise covariance matrices (F and Q) are initialized
+  *          and a UD (Cholesky) decomposition is perfomed in Q, for use in the Kalman predict step.
+  * @param model The model that caches the processes.
+  * @param dt The (measured) time step of the prediction.
+  * @return The process model of the time step.
+  */
+const TrackingProcess_t* GetTrackingProcess(TrackingModel_t* model, const real_t dt);
+
+/**
+  * @brief Accumulates a plot (measurement) of a track in information form.
+  * @details The weight is applied as an inflation of the plot's noise (R / weight). The inverse of the inflated noise
+  *          is added to the information matrix (Y), and the plot scaled by the same inverse to the information vector (y).
+  *          A plot with a weight of 1 fuses as with `FuseTrack`. With a lower weight it does not, since `FuseTrack` scales
+  *          the innovation of each state instead, which differs when the covariance of the track is correlated.
+  *          A plot with no weight (zero) carries no information and is not accumulated.
+  * @param information The information accumulated for the track in this cycle.
+  * @param plot The plot to be accumulated.
+  * @return Void.
+  */
+void AccumulatePlotInformation(PlotInformation_t* information, const Plot_t* plot);
+
+/**
+  * @brief Fuses the information accumulated for a track.
+  * @details The information is converted back to an equivalent plot,
+  *          which is fused with the track in a single update step. No action is taken if nothing was accumulated.
+  * @param track The track to be fused with.
+  * @param information The information accumulated for the track in this cycle.
+  * @return Void.
+  */
+void FusePlotInformation(Track_t* track, const PlotInformation_t* information);
 
 /**
   * @brief Initializes a track given a plot (measurement).
@@ -53,23 +87,73 @@ void InitializeTrack(Track_t* track, const Plot_t* plot);
   * @brief Performs the predict step of the Kalman filter for a track.
   * @details First, the P matrix is predicted and directly decomposed (UD).
   *          Then, the X matrix is predicted.
-  *          Lastly, backwards composition is performed on P for use in the update step.
+  *          Lastly, the variances of P are computed from the UD factors for use in the gating.
+  * @param process The process model that the track is predicted with.
   * @param track The track to be predicted.
   * @todo Handle object appropriately if new values are out of limits.
   * @return Void.
   */
-void PredictTrack(Track_t* track);
+void PredictTrack(const TrackingProcess_t* process, Track_t* track);
 
 /**
   * @brief Performs the update step of the Kalman filter.
-  * @details For each state, the innovation (residual) is calculated and the two distributions
-  *          are multiplied (fused).
+  * @details For each state in turn, the innovation (residual) is calculated and the two distributions
+  *          are multiplied (fused). Each state takes its own triangular walk over the UD factors, from the measured state on,
+  *          and the transformation matrix (H) is never materialized (see `FuseUnitStates`).
   * @param track The original track to be fused with.
   * @param plot The plot that will be fused with its paired track.
   * @return Void.
   */
 void FuseTrack(Track_t* track, const Plot_t* plot);
 
+/**
+  * @brief Stores a track to a lane of a track batch.
+  * @param batch The batch of tracks.
+  * @param lane The lane (index) of the batch to store the track to.
+  * @param track The track to be stored.
+  * @return Void.
+  */
+void SetBatchTrack(TrackBatch_t* batch, const u8_t lane, const Track_t* track);
+
+/**
+  * @brief Loads a track from a lane of a track batch.
+  * @param batch The batch of tracks.
+  * @param lane The lane (index) of the batch to load the track from.
+  * @param track The track to be loaded.
+  * @return Void.
+  */
+void GetBatchTrack(const TrackBatch_t* batch, const u8_t lane, Track_t* track);
+
+/**
+  * @brief Performs the predict step of the Kalman filter for a batch of tracks.
+  * @details Same as `PredictTrack`, but the tracks are advanced lane-parallel,
+  *          one block of `VECTOR_LANES` tracks at a time.
+  * @param process The process model that the tracks are predicted with.
+  * @param batch The batch of tracks to be predicted.
+  * @return Void.
+  */
+void PredictTracks(const TrackingProcess_t* process, TrackBatch_t* batch);
+
+/**
+  * @brief Gets the variance of a state of a track.
+  * @details For the UD kernel, the variance is read from the predicted covariance matrix (P_V).
+  *          For the decoupled kernel, it is read from the covariance matrix of the axis.
+  * @param track The track to get the variance from.
+  * @param state The state of the variance.
+  * @return The variance of the state.
+  */
+real_t GetTrackVariance(const Track_t* track, const u8_t state);
+
+/**
+  * @brief Gets the full covariance matrix of a track.
+  * @details The matrix is not stored in the track, it is composed on demand
+  *          from the factors (UD kernel) or the axis matrices (decoupled kernel).
+  * @param track The track to get the covariance matrix from.
+  * @param P The covariance matrix of the track.
+  * @return Void.
+  */
+void GetTrackCovariance(const Track_t* track, real_t* P);
+
 /*****************************************************************************/
 
 #ifdef __cplusplus
@@ -0,0 +1,137 @@
+/*
+ * Copyright (C) 2016 Dimitris Geromichalos
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef VECTOR_TYPES_H
+#define VECTOR_TYPES_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************** Inclusions *********************************/
+
+#include <string.h>
+
+#include "common_types.h"
+#include "real_types.h"
+
+/***************************** Macro Definitions *****************************/
+
+/**
+  * The number of lanes processed in parallel by the batched kernels.
+  * A 128-bit vector (4 floats or 2 doubles) maps to SSE on x86 and to NEON on ARM
+  * (ARMv7 needs -mfpu=neon and has no double lanes, AArch64 uses it by default).
+  */
+#if (FUSION_PRECISION == FUSION_PRECISION_F64)
+#define VECTOR_LANES (2u)
+#else
+#define VECTOR_LANES (4u)
+#endif
+
+/** Round up a number of elements to a multiple of the vector lanes. */
+#define GET_SIZE_LANES(N) ((((N) + VECTOR_LANES - 1u) / VECTOR_LANES) * VECTOR_LANES)
+
+/***************************** Type Definitions ******************************/
+
+/**
+  * @typedef vreal_t
+  * @brief A vector of reals, using the GCC vector extensions.
+  * @details Arithmetic operators work lane-wise and a scalar operand is broadcast to all lanes.
+  *          Without the extensions, the batched kernels fall back to one lane at a time.
+  */
+#if defined(__GNUC__)
+#define VECTOR_EXTENSIONS
+typedef real_t vreal_t __attribute__((vector_size(sizeof(real_t) * VECTOR_LANES)));
+#endif
+
+/***************************** Public Functions ******************************/
+
+#ifdef VECTOR_EXTENSIONS
+
+/**
+  * @brief Broadcasts a scalar to all the lanes of a vector.
+  * @param x The scalar to be broadcast.
+  * @return The vector.
+  */
+static inline vreal_t BroadcastLanes(const real_t x)
+{
+    vreal_t v = { 0.f };
+
+    return (v + x);
+}
+
+/**
+  * @brief Loads the lanes of a vector from an array.
+  * @details Lanes beyond the valid ones are filled with the first element,
+  *          so that padding lanes always hold sane values (no division by zero etc.).
+  * @param src The array to load from (does not need to be aligned).
+  * @param valid The number of valid elements in the array.
+  * @return The loaded vector.
+  */
+static inline vreal_t LoadLanes(const real_t* src, const u32_t valid)
+{
+    vreal_t v;
+    u32_t i;
+
+    if (valid >= VECTOR_LANES)
+    {
+        (void)memcpy(&v, src, sizeof(vreal_t));
+    }
+    else
+    {
+        for (i = 0u; i < VECTOR_LANES; i++)
+        {
+            v[i] = src[(i < valid) ? i : 0u];
+        }
+    }
+
+    return v;
+}
+
+/**
+  * @brief Stores the valid lanes of a vector to an array.
+  * @param dst The array to store to (does not need to be aligned).
+  * @param v The vector to be stored.
+  * @param valid The number of valid elements in the array.
+  * @return Void.
+  */
+static inline void StoreLanes(real_t* dst, const vreal_t v, const u32_t valid)
+{
+    u32_t i;
+
+    if (valid >= VECTOR_LANES)
+    {
+        (void)memcpy(dst, &v, sizeof(vreal_t));
+    }
+    else
+    {
+        for (i = 0u; i < valid; i++)
+        {
+            dst[i] = v[i];
+        }
+    }
+}
+
+#endif
+
+/*****************************************************************************/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* VECTOR_TYPES_H */
@@ -58,6 +58,7 @@ typedef struct {
   */
 typedef struct {
     u8_t valid;
+    u8_t id;
 
     f32_t posX;
     f32_t posY;
@@ -99,7 +100,7 @@ typedef struct {
 typedef struct {
     u8_t index;
     u8_t length;
-    void (*GetObject)(const u8_t, const u8_t*, BaseObject_t*);
+    void (*DecodeObject)(const u8_t, const u8_t*);
 } SensorObjects_t;
 
 /**
@@ -107,6 +108,7 @@ typedef struct {
   * @brief An input sensor.
   */
 typedef struct {
+    u8_t id;
     SensorType_t type;
     SensorTF_t tf;
     SensorObjects_t objects;
@@ -38,17 +38,13 @@ extern "C" {
 void InitializeCanInterface(void);
 
 /**
-  * @brief Copy the contents of the prefused (Rx) buffers of the CAN module.
-  * @details The received and frame lists are copied from the main CAN module
-  *          to an external interface, in order to use the data collected so far.
-  *          When a cal to this function is made, all CAN IRQs are suspended
-  *          and the mutexes associated with the buffers are locked, in order
-  *          to synchronize the incoming data as well as avoid corruption.
-  * @param receivedList A list containing a "received" flag for each incoming frame.
-  * @param frameList A list containing the actual CAN frames.
-  * @return Void.
+  * @brief Gets a prefused frame from the Rx buffers of the CAN module, in place.
+  * @details The frame is not copied, so that it can be decoded straight from the buffer
+  *          the CAN IRQ received it to. It remains valid until the Rx buffers are reset.
+  * @param index The index of the frame in the Rx buffers.
+  * @return The frame, or NULL if it has not been received in this cycle.
   */
-void CopyPrefusedFrameList(u8_t* receivedList, CanFrame_t* frameList);
+const CanFrame_t* GetPrefusedFrame(const u8_t index);
 
 /**
   * @brief Transmit a CAN frame to the CAN bus.
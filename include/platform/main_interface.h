@@ -43,17 +43,18 @@ extern "C" {
 void Initialize(void);
 
 /**
-  * @brief Copy the prefused data from the CAN module to the local buffers.
-  * @details Copy the raw data (CAN frames) and convert it to objects, that
-  *          can be inputted to the algo module.
+  * @brief Decode the prefused data of the CAN module straight to the input objects of the algo module.
+  * @details The raw data (CAN frames) is read in place from the Rx buffers of the CAN module
+  *          and each received object is converted once, to the prefused object list of the algo module.
   * @todo Generate warning/DTC when not all prefused objects have been received.
   * @return Void.
   */
-void CopyPrefusedData(void);
+void DecodePrefusedData(void);
 
 /**
   * @brief Executes one step of the fusion algorithm.
-  * @details Calls the algorithm using the previously created prefused object list.
+  * @details Calls the algorithm using the previously decoded prefused objects
+  *          and the time measured since the previous execution (nominal cycle time for the first one).
   *          When the execution completes, a fused object list is returned.
   * @return Void.
   */
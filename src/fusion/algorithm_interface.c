@@ -31,142 +31,197 @@
 #include "config.h"
 #include "fusion.h"
 #include "fusion_utils.h"
+#include "fused_object_store.h"
 
 #include "algorithm_interface.h"
 
 /***************************** Static Variables ******************************/
 
+/** The capacities that the algorithm was last initialized with. */
+static AlgorithmConfig_t algorithmConfig;
+
 /** The list that contains all the input sensors of the system. */
 static Sensor_t sensorList[NUM_SENSORS];
 
-/** The list (buffer) that contains all the objects that have been fed by an external module. */
-static BaseObject_t inputObjectList[NUM_PREFUSED_OBJ];
-
-/** The list (buffer) that contains all the objects that are ready to be outputtted to an external module. */
-static BaseObject_t outputObjectList[NUM_FUSED_OBJ];
-
-/** The list that contains all the prefused objects that are inputted to the algo. */
+/** The list that contains all the prefused objects that are inputted to the algo (input objects are decoded straight into it). */
 static PrefusedObject_t prefusedObjectList[NUM_PREFUSED_OBJ];
 
-/** The list that contains all the fused objects that are tracked by the algo. */
-static FusedObject_t fusedObjectList[NUM_FUSED_OBJ];
+/** The number of input objects added to the prefused object list in this cycle. */
+static u8_t numInputObjects;
+
+/** The store that contains all the fused objects that are tracked by the algo. */
+static FusedObjectStore_t fusedObjectStore;
 
 /************************ Static Function Prototypes *************************/
 
 /**
-  * @brief Cycles through the input object list and adds the valid objects to the prefusedObjectList.
-  * @details Determines if an input object is valid and tracked and determines the sensor it comes from.
-  * @return Void.
+  * @brief Gets a capacity of the configuration.
+  * @param capacity The requested capacity.
+  * @param maxCapacity The maximum capacity (that the list is stored for).
+  * @return The requested capacity, or the maximum one if the requested is zero or above it.
   */
-static void PrepareInputObjects(void);
+static u16_t GetCapacity(const u16_t capacity, const u16_t maxCapacity);
 
 /**
-  * @brief Converts an input object to a prefused object (native).
-  * @details The input object's information (pos/vel) as well as the sensor that is coming from are stored to the prefused object.
-  * @param prefusedObject A prefused object used as an input to the algo.
-  * @param inputObject An object of platform type, coming from an external module.
-  * @param sensor A sensor of the system. Its type and geometry is contained.
+  * @brief Clears the prefused objects added in this cycle, so that the list is empty for the next one.
   * @return Void.
   */
-static void AddInputObject(PrefusedObject_t* prefusedObject, const BaseObject_t* inputObject, const Sensor_t* sensor);
+static void ResetInputObjects(void);
 
 /**
-  * @brief Cycles through the fusedObjectList (output of the algo) and adds the valid object to the output object list.
+  * @brief Cycles through the fused object store (output of the algo) and adds the valid object to the output object list.
   * @details For each valid fused object, it checks if the tentative object has been confirmed (is stable enough) and adds it.
+  *          Only the configured number of fused objects can be valid, so that only as many output objects are cleared.
+  * @param pOutputObjectList The output object list of an external module (filled in place).
   * @todo Sort according to TTC.
   * @return Void.
   */
-static void PrepareOutputObjects(void);
+static void PrepareOutputObjects(BaseObject_t* pOutputObjectList);
 
 /**
   * @brief Converts a fused object (native) to an output object.
   * @details The fused object's information (pos/vel) and id are stored to the output object.
   * @param outputObject An object of platform type, targeted to an external module.
-  * @param fusedObject A fused object that is outputted from the algo.
+  * @param index The index of a fused object that is outputted from the algo.
   * @todo Use the vehicle_speed from VehDyn data to determine if object is moving.
   * @todo Add quality signals.
   * @return Void.
   */
-static void AddOutputObject(BaseObject_t* outputObject, const FusedObject_t* fusedObject);
+static void AddOutputObject(BaseObject_t* outputObject, const u8_t index);
 
 /***************************** Static Functions ******************************/
 
-void PrepareInputObjects(void)
+u16_t GetCapacity(const u16_t capacity, const u16_t maxCapacity)
 {
-    u8_t i;
-    Sensor_t* sensor = NULL;
-    u8_t numInputObjects = 0u;
-
-    (void)memset(prefusedObjectList, 0, sizeof(PrefusedObject_t) * (u32_t)NUM_PREFUSED_OBJ);
-
-    for (i = 0u; i < NUM_PREFUSED_OBJ; i++)
-    {
-        if (inputObjectList[i].valid && GetSensorFromIndex(i, &sensor))
-        {          
-            AddInputObject(&prefusedObjectList[numInputObjects], &inputObjectList[i], sensor);
-
-            numInputObjects++;
-        }
-    }
+    return (((capacity == 0u) || (capacity > maxCapacity)) ? maxCapacity : capacity);
 }
 
-void AddInputObject(PrefusedObject_t* prefusedObject, const BaseObject_t* inputObject, const Sensor_t* sensor)
+void ResetInputObjects(void)
 {
-    f32_t x = inputObject->posX;
-    f32_t y = inputObject->posY;
-    f32_t vx = inputObject->velX;
-    f32_t vy = inputObject->velY;
+    (void)memset(prefusedObjectList, 0, sizeof(PrefusedObject_t) * (u32_t)numInputObjects);
 
-    CreatePrefusedObject(prefusedObject, sensor, x, y, vx, vy);
+    numInputObjects = 0u;
 }
 
-void PrepareOutputObjects(void)
+void PrepareOutputObjects(BaseObject_t* pOutputObjectList)
 {
     u8_t i;
     u8_t numOutputObjects = 0u;
 
-    (void)memset(outputObjectList, 0, sizeof(BaseObject_t) * (u32_t)NUM_FUSED_OBJ);
+    (void)memset(pOutputObjectList, 0, sizeof(BaseObject_t) * (u32_t)algorithmConfig.numFusedObjects);
 
-    for (i = 0u; i < NUM_FUSED_OBJ; i++)
+    for (i = GetNextLiveFusedObject(&fusedObjectStore, 0u); i < NUM_FUSED_OBJ; i = GetNextLiveFusedObject(&fusedObjectStore, i + 1u))
     {
-        if (IsTentativeObjectConfirmed(&fusedObjectList[i]))
+        if (IsTentativeObjectConfirmed(&fusedObjectStore, i))
         {
-            AddOutputObject(&outputObjectList[numOutputObjects], &fusedObjectList[i]);
+            AddOutputObject(&pOutputObjectList[numOutputObjects], i);
 
             numOutputObjects++;
         }
     }
 }
 
-void AddOutputObject(BaseObject_t* outputObject, const FusedObject_t* fusedObject)
+void AddOutputObject(BaseObject_t* outputObject, const u8_t index)
 {
-    outputObject->valid = (fusedObject->id == INVALID_ID) ? 0 : 1;
+    const real_t* X = fusedObjectStore.cold[index].track.X;
 
-    outputObject->posX = fusedObject->track.X[STATE_X];
-    outputObject->posY = fusedObject->track.X[STATE_Y];
-    outputObject->velX = fusedObject->track.X[STATE_VX];
-    outputObject->velY = fusedObject->track.X[STATE_VY];
+    outputObject->valid = (fusedObjectStore.hot[index].id == INVALID_ID) ? 0 : 1;
+
+    outputObject->posX = X[STATE_X];
+    outputObject->posY = X[STATE_Y];
+    outputObject->velX = X[STATE_VX];
+    outputObject->velY = X[STATE_VY];
 }
 
 /***************************** Public Functions ******************************/
 
-void InitializeAlgorithm(void)
+u8_t InitializeAlgorithm(const AlgorithmConfig_t* config)
 {
-    InitializeSensorInterface(sensorList);
+    AlgorithmConfig_t requested;
+    AlgorithmConfig_t capacities;
+    u8_t valid;
+
+    (void)memset(&requested, 0, sizeof(AlgorithmConfig_t));
 
-    (void)memset(prefusedObjectList, 0, sizeof(PrefusedObject_t) * (u32_t)NUM_PREFUSED_OBJ);
-    (void)memset(fusedObjectList, 0, sizeof(FusedObject_t) * (u32_t)NUM_FUSED_OBJ);
+    if (config != NULL)
+    {
+        requested = *config;
+    }
 
-    InitializeFusion();
+    capacities.numPrefusedObjects = (u8_t)GetCapacity(requested.numPrefusedObjects, NUM_PREFUSED_OBJ);
+    capacities.numFusedObjects = (u8_t)GetCapacity(requested.numFusedObjects, NUM_FUSED_OBJ);
+    capacities.numSensors = (u8_t)GetCapacity(requested.numSensors, NUM_SENSORS);
+    capacities.maxId = (ObjectId_t)GetCapacity(requested.maxId, MAX_ID);
+
+    /* The ID zero is invalid, so that each object slot needs an ID below the max ID. */
+    valid = (capacities.maxId > capacities.numFusedObjects);
+
+    if (valid)
+    {
+        algorithmConfig = capacities;
+
+        InitializeSensorInterface(sensorList);
+
+        (void)memset(prefusedObjectList, 0, sizeof(PrefusedObject_t) * (u32_t)NUM_PREFUSED_OBJ);
+        numInputObjects = 0u;
+        ResetFusedObjectStore(&fusedObjectStore);
+
+        InitializeFusion(&algorithmConfig);
+    }
+
+    return valid;
 }
 
-void RunAlgorithm(const BaseObject_t* pInputObjectList, BaseObject_t* pOutputObjectList)
+const AlgorithmConfig_t* GetAlgorithmConfig(void)
 {
-    (void)memcpy(inputObjectList, pInputObjectList, sizeof(BaseObject_t) * (u32_t)NUM_PREFUSED_OBJ);
-    PrepareInputObjects();
+    return &algorithmConfig;
+}
 
-    RunFusion(prefusedObjectList, fusedObjectList);
+void AddInputObject(const u8_t index, const u8_t sensorObjectId, const f32_t posX, const f32_t posY, const f32_t velX, const f32_t velY)
+{
+    Sensor_t* sensor = NULL;
+    PrefusedObject_t* prefusedObject;
+
+    if ((numInputObjects < algorithmConfig.numPrefusedObjects) && GetSensorFromIndex(index, &sensor) &&
+        (sensor->id < algorithmConfig.numSensors))
+    {
+        prefusedObject = &prefusedObjectList[numInputObjects];
+
+        CreatePrefusedObject(prefusedObject, sensor, posX, posY, velX, velY);
+
+        prefusedObject->sensorObjectId = sensorObjectId;
+
+        numInputObjects++;
+    }
+}
+
+void RunAlgorithmOnInputObjects(BaseObject_t* pOutputObjectList, const f32_t dt)
+{
+    RunFusion(prefusedObjectList, numInputObjects, &fusedObjectStore, dt);
+    ResetInputObjects();
+
+    PrepareOutputObjects(pOutputObjectList);
+}
 
-    PrepareOutputObjects();
-    (void)memcpy(pOutputObjectList, outputObjectList, sizeof(BaseObject_t) * (u32_t)NUM_FUSED_OBJ);
+void RunAlgorithm(const BaseObject_t* pInputObjectList, BaseObject_t* pOutputObjectList, const f32_t dt)
+{
+    u8_t i;
+    const BaseObject_t* inputObject;
+
+    for (i = 0u; i < NUM_PREFUSED_OBJ; i++)
+    {
+        inputObject = &pInputObjectList[i];
+
+        if (inputObject->valid)
+        {
+            AddInputObject(i, inputObject->id, inputObject->posX, inputObject->posY, inputObject->velX, inputObject->velY);
+        }
+    }
+
+    RunAlgorithmOnInputObjects(pOutputObjectList, dt);
+}
+
+void GetAlgorithmStats(AssociationStats_t* pStats)
+{
+    GetAssociationStats(pStats);
 }
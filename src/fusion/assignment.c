@@ -0,0 +1,115 @@
+/*
+ * Copyright (C) 2016 Dimitris Geromichalos
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+ /**
+  * A solver for the linear assignment problem, used by the global nearest neighbour association.
+  * The rows are added one at a time and each one is assigned through the shortest augmenting path,
+  * while the row and column potentials keep all the reduced costs non-negative.
+  */
+
+/******************************** Inclusions *********************************/
+
+#include <string.h>
+
+#include "constants.h"
+
+#include "assignment.h"
+
+/***************************** Public Functions ******************************/
+
+void SolveAssignment(AssignmentWorkspace_t* workspace, const u8_t rows, const u8_t cols, u8_t* assignment)
+{
+    u8_t i, j, row, col, nextCol;
+    real_t slack, delta;
+
+    (void)memset(workspace->rowPotential, 0, sizeof(workspace->rowPotential));
+    (void)memset(workspace->colPotential, 0, sizeof(workspace->colPotential));
+    (void)memset(workspace->colRow, 0, sizeof(workspace->colRow));
+    (void)memset(workspace->colPath, 0, sizeof(workspace->colPath));
+
+    for (i = 1u; i <= rows; i++)
+    {
+        /* Column 0 is the virtual start column, holding the row to be added. */
+        workspace->colRow[0] = i;
+        col = 0u;
+        nextCol = 0u;
+
+        for (j = 0u; j <= cols; j++)
+        {
+            workspace->minSlack[j] = INFINITE_ASSIGNMENT_COST;
+            workspace->colVisited[j] = FALSE;
+        }
+
+        do
+        {
+            workspace->colVisited[col] = TRUE;
+            row = workspace->colRow[col];
+            delta = INFINITE_ASSIGNMENT_COST;
+
+            for (j = 1u; j <= cols; j++)
+            {
+                if (!workspace->colVisited[j])
+                {
+                    slack = workspace->cost[row - 1u][j - 1u] - workspace->rowPotential[row] - workspace->colPotential[j];
+
+                    if (slack < workspace->minSlack[j])
+                    {
+                        workspace->minSlack[j] = slack;
+                        workspace->colPath[j] = col;
+                    }
+
+                    if (workspace->minSlack[j] < delta)
+                    {
+                        delta = workspace->minSlack[j];
+                        nextCol = j;
+                    }
+                }
+            }
+
+            for (j = 0u; j <= cols; j++)
+            {
+                if (workspace->colVisited[j])
+                {
+                    workspace->rowPotential[workspace->colRow[j]] += delta;
+                    workspace->colPotential[j] -= delta;
+                }
+                else
+                {
+                    workspace->minSlack[j] -= delta;
+                }
+            }
+
+            col = nextCol;
+        } while (workspace->colRow[col] != 0u);
+
+        /* Augment along the path back to the start column. */
+        do
+        {
+            nextCol = workspace->colPath[col];
+            workspace->colRow[col] = workspace->colRow[nextCol];
+            col = nextCol;
+        } while (col != 0u);
+    }
+
+    for (j = 1u; j <= cols; j++)
+    {
+        if (workspace->colRow[j] != 0u)
+        {
+            assignment[workspace->colRow[j] - 1u] = j - 1u;
+        }
+    }
+}
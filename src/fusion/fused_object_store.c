@@ -0,0 +1,97 @@
+/*
+ * Copyright (C) 2016 Dimitris Geromichalos
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+ /**
+  * The store of the fused objects, split into hot and cold records indexed by the fused object list.
+  * The algorithm accesses the fields of the store directly, while a single object can be gathered
+  * to (or scattered from) a `FusedObject_t`, e.g. to be set up or checked by the tests.
+  * The hot mean and variances are a copy of the track, refreshed whenever the track is modified,
+  * and the live bitmap follows the IDs, updated whenever an ID is set or cleared.
+  */
+
+/******************************** Inclusions *********************************/
+
+#include <string.h>
+
+#include "tracking.h"
+#include "fused_object_store.h"
+
+/***************************** Public Functions ******************************/
+
+void ResetFusedObjectStore(FusedObjectStore_t* store)
+{
+    (void)memset(store, 0, sizeof(FusedObjectStore_t));
+}
+
+void SetFusedObjectLive(FusedObjectStore_t* store, const u8_t index, const u8_t live)
+{
+    if (live)
+    {
+        SetBitmapBit(store->live, index);
+    }
+    else
+    {
+        ClearBitmapBit(store->live, index);
+    }
+}
+
+void UpdateHotFusedObject(FusedObjectStore_t* store, const u8_t index)
+{
+    u8_t i;
+    const Track_t* track = &store->cold[index].track;
+
+    for (i = 0u; i < KALMAN_STATES; i++)
+    {
+        store->hot[index].X[i] = track->X[i];
+        store->hot[index].variance[i] = GetTrackVariance(track, i);
+    }
+}
+
+void GetFusedObject(const FusedObjectStore_t* store, const u8_t index, FusedObject_t* fusedObject)
+{
+    u8_t i;
+
+    fusedObject->id = store->hot[index].id;
+    fusedObject->track = store->cold[index].track;
+    fusedObject->lifetimeCounter = store->cold[index].lifetimeCounter;
+    fusedObject->lostCounter = store->hot[index].lostCounter;
+    fusedObject->priority = store->hot[index].priority;
+
+    for (i = 0u; i < NUM_SENSORS; i++)
+    {
+        fusedObject->seenThisCycle[i] = store->hot[index].seenThisCycle[i];
+    }
+}
+
+void SetFusedObject(FusedObjectStore_t* store, const u8_t index, const FusedObject_t* fusedObject)
+{
+    u8_t i;
+
+    store->hot[index].id = fusedObject->id;
+    store->cold[index].track = fusedObject->track;
+    store->cold[index].lifetimeCounter = fusedObject->lifetimeCounter;
+    store->hot[index].lostCounter = fusedObject->lostCounter;
+    store->hot[index].priority = fusedObject->priority;
+
+    for (i = 0u; i < NUM_SENSORS; i++)
+    {
+        store->hot[index].seenThisCycle[i] = fusedObject->seenThisCycle[i];
+    }
+
+    SetFusedObjectLive(store, index, (fusedObject->id != INVALID_ID));
+    UpdateHotFusedObject(store, index);
+}
@@ -27,6 +27,7 @@
 /******************************** Inclusions *********************************/
 
 #include <string.h>
+#include <time.h>
 
 #include "constants.h"
 #include "platform_params.h"
@@ -34,104 +35,168 @@
 #include "fusion_utils.h"
 #include "radar_utils.h"
 #include "tracking.h"
+#include "fused_object_store.h"
 
 #include "fusion.h"
 
+/***************************** Static Variables ******************************/
+
+/** The cache of the process models that the tracks are predicted with. */
+static TrackingModel_t trackingModel;
+
+/** The batch that holds the valid fused objects' tracks during the predict step. */
+static TrackBatch_t trackBatch TRACK_STORAGE_ALIGNED;
+
+/** The index in the fused object list of each track in the batch. */
+static u8_t trackBatchIndex[NUM_FUSED_OBJ];
+
+/** The number of the sensors of the configuration, whose prefused objects are associated in turn. */
+static u8_t numSensors;
+
+/** The cost of the association of the last cycle. */
+static AssociationStats_t associationStats;
+
 /************************ Static Function Prototypes *************************/
 
 /**
   * @brief Predicts the next state of the fused objects.
-  * @details For each valid fused object, predicts its next state.
+  * @details The tracks of all the valid fused objects are gathered to a batch
+  *          and predicted lane-parallel. Then, they are scattered back and their priority is updated.
+  *          Finally, the grid that the acceptance gate uses is rebuilt from the predicted tracks
+  *          and the eviction heap from the updated priorities.
+  * @param dt The time step since the previous cycle.
   * @return Void.
   */
-static void Predict(FusedObject_t* fusedObjectList);
+static void Predict(FusedObjectStore_t* fusedObjectStore, const real_t dt);
 
 /**
   * @brief Updates the fused objects with the information from the prefused objects.
   * @details Each prefused object passes from an acceptance gate.
   *          If it succeeds, it fuses with its paired object. If not, an new object is created from it.
+  *          First, all the prefused objects are gated against the predicted objects, the ones of each sensor in parallel.
+  *          Then, they are associated in order, the gating values of the objects changed meanwhile being recalculated.
+  *          In the GNN and JPDA association modes, the prefused objects of each sensor are associated at once.
+  *          The time of the whole step is kept in the association statistics of the cycle.
+  *          In the information update mode, the paired plots are fused once all the prefused objects are associated.
+  * @param prefusedObjectList A list containing the prefused objects (input of algo).
+  * @param numPrefusedObjects The number of prefused objects (at the front of the list).
+  * @param fusedObjectStore The store of the fused objects (output of algo).
   * @return Void.
   */
-static void Update(const PrefusedObject_t* prefusedObjectList, FusedObject_t* fusedObjectList);
+static void Update(const PrefusedObject_t* prefusedObjectList, const u8_t numPrefusedObjects, FusedObjectStore_t* fusedObjectStore);
 
 /**
   * @brief Performs maintenance functions on the fused objects.
-  * @details Each valid fused object is checked with the rest of the objects for pruning.
+  * @details Each valid fused object is checked with the objects near it (in x) for pruning.
   *          If the 2 objects are very close, one of them will be deleted.
   *          All the remaining valid objects have their lifetime and lost counters updated.
   * @return Void.
   */
-static void Manage(FusedObject_t* fusedObjectList);
+static void Manage(FusedObjectStore_t* fusedObjectStore);
 
 /***************************** Static Functions ******************************/
 
-void Predict(FusedObject_t* fusedObjectList)
+void Predict(FusedObjectStore_t* fusedObjectStore, const real_t dt)
 {
-    u8_t i;
+    u8_t i, lane;
+    const TrackingProcess_t* process = GetTrackingProcess(&trackingModel, dt);
+
+    trackBatch.count = 0u;
 
-    for (i = 0u; i < NUM_FUSED_OBJ; i++)
+    for (i = GetNextLiveFusedObject(fusedObjectStore, 0u); i < NUM_FUSED_OBJ; i = GetNextLiveFusedObject(fusedObjectStore, i + 1u))
     {
-        if (fusedObjectList[i].id != INVALID_ID)
-        {
-            PredictTrack(&fusedObjectList[i].track);
+        SetBatchTrack(&trackBatch, trackBatch.count, &fusedObjectStore->cold[i].track);
 
-            fusedObjectList[i].priority = GetObjectPriority(fusedObjectList[i].track.X[STATE_X], fusedObjectList[i].track.X[STATE_Y]);
-        }
+        trackBatchIndex[trackBatch.count] = i;
+        trackBatch.count++;
     }
+
+    PredictTracks(process, &trackBatch);
+
+    for (lane = 0u; lane < trackBatch.count; lane++)
+    {
+        i = trackBatchIndex[lane];
+
+        GetBatchTrack(&trackBatch, lane, &fusedObjectStore->cold[i].track);
+        UpdateHotFusedObject(fusedObjectStore, i);
+
+        fusedObjectStore->hot[i].priority = GetObjectPriority(fusedObjectStore->hot[i].X[STATE_X], fusedObjectStore->hot[i].X[STATE_Y]);
+    }
+
+    BuildTrackGrid(fusedObjectStore);
+    BuildEvictionHeap(fusedObjectStore);
 }
 
-void Update(const PrefusedObject_t* prefusedObjectList,  FusedObject_t* fusedObjectList)
+void Update(const PrefusedObject_t* prefusedObjectList, const u8_t numPrefusedObjects, FusedObjectStore_t* fusedObjectStore)
 {
     u8_t i;
+    struct timespec startTime, endTime;
+
+    (void)memset(&associationStats, 0, sizeof(AssociationStats_t));
+    (void)clock_gettime(CLOCK_MONOTONIC, &startTime);
 
-    for (i = 0u; i < NUM_PREFUSED_OBJ; i++)
+    GatePrefusedObjects(prefusedObjectList, numPrefusedObjects);
+
+    if (ASSOCIATION_MODE == ASSOCIATION_MODE_GNN)
     {
-        if (prefusedObjectList[i].valid)
+        for (i = 0u; i < numSensors; i++)
         {
-            AssociatePrefusedObject(&prefusedObjectList[i], fusedObjectList);
+            AssociateSensorObjects(prefusedObjectList, numPrefusedObjects, i, fusedObjectStore);
         }
     }
-}
-
-void Manage(FusedObject_t* fusedObjectList)
-{
-    u8_t i, j;
-
-    for (i = 0u; i < NUM_FUSED_OBJ; i++)
+    else if (ASSOCIATION_MODE == ASSOCIATION_MODE_JPDA)
     {
-        if (fusedObjectList[i].id != INVALID_ID)
+        for (i = 0u; i < numSensors; i++)
         {
-            for (j = (i + 1u); j < NUM_FUSED_OBJ; j++)
-            {
-                if ((fusedObjectList[i].id != INVALID_ID) &&
-                    (fusedObjectList[j].id != INVALID_ID))
-                {
-                    CheckObjectsForPruning(&fusedObjectList[i], &fusedObjectList[j]);
-                }
-            }
+            AssociateSensorHypotheses(prefusedObjectList, numPrefusedObjects, i, fusedObjectStore, &associationStats);
         }
     }
-
-    for (i = 0u; i < NUM_FUSED_OBJ; i++)
+    else
     {
-        if (fusedObjectList[i].id != INVALID_ID)
+        for (i = 0u; i < numPrefusedObjects; i++)
         {
-            MaintainObject(&fusedObjectList[i]);
+            AssociatePrefusedObject(prefusedObjectList, i, fusedObjectStore);
         }
     }
+
+    FuseAccumulatedPlots(fusedObjectStore);
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &endTime);
+
+    associationStats.time = (f32_t)(endTime.tv_sec - startTime.tv_sec) +
+                            ((f32_t)(endTime.tv_nsec - startTime.tv_nsec) * 1e-9f);
+}
+
+void Manage(FusedObjectStore_t* fusedObjectStore)
+{
+    u8_t i;
+
+    PruneObjects(fusedObjectStore);
+
+    for (i = GetNextLiveFusedObject(fusedObjectStore, 0u); i < NUM_FUSED_OBJ; i = GetNextLiveFusedObject(fusedObjectStore, i + 1u))
+    {
+        MaintainObject(fusedObjectStore, i);
+    }
 }
 
 /***************************** Public Functions ******************************/
 
-void InitializeFusion(void)
+void InitializeFusion(const AlgorithmConfig_t* config)
+{
+    numSensors = config->numSensors;
+
+    InitializeTracking(&trackingModel, CYCLE_TIME);
+    InitializeFusionUtils(config);
+}
+
+void RunFusion(const PrefusedObject_t* prefusedObjectList, const u8_t numPrefusedObjects, FusedObjectStore_t* fusedObjectStore, const real_t dt)
 {
-    InitializeTracking(CYCLE_TIME);
-    InitializeFusionUtils();
+    Predict(fusedObjectStore, dt);
+    Update(prefusedObjectList, numPrefusedObjects, fusedObjectStore);
+    Manage(fusedObjectStore);
 }
 
-void RunFusion(const PrefusedObject_t* prefusedObjectList, FusedObject_t* fusedObjectList)
+void GetAssociationStats(AssociationStats_t* stats)
 {
-    Predict(fusedObjectList);
-    Update(prefusedObjectList, fusedObjectList);
-    Manage(fusedObjectList);
+    *stats = associationStats;
 }
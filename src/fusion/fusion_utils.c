@@ -28,13 +28,54 @@
 #include "config.h"
 #include "radar_utils.h"
 #include "tracking.h"
+#include "track_grid.h"
+#include "gating.h"
+#include "gating_workers.h"
+#include "id_allocator.h"
+#include "priority_heap.h"
+#include "assignment.h"
+#include "jpda.h"
+#include "fused_object_store.h"
 
 #include "fusion_utils.h"
 
 /***************************** Static Variables ******************************/
 
-static f32_t gatingWeights[KALMAN_STATES];
-static f32_t totalGatingValueMinLimit;
+static real_t gatingWeights[KALMAN_STATES];
+static real_t totalGatingValueMinLimit;
+
+/** The plots accumulated for each fused object during the cycle (information update mode). */
+static PlotInformation_t plotInformation[NUM_FUSED_OBJ];
+
+/** The grid over the positions of the fused objects' tracks, valid from the predict step until the end of the update step. */
+static TrackGrid_t trackGrid;
+
+/** The means and variances of the fused objects' tracks, valid for the same span as the grid. */
+static GatingTracks_t gatingTracks;
+
+/** The gating values of each prefused object, against the gating tracks as they were when its sensor was gated. */
+static real_t plotGatingValues[NUM_PREFUSED_OBJ][NUM_BATCH_TRACKS];
+
+/** The IDs used by the fused objects. */
+static IdAllocator_t idAllocator;
+
+/** The fused objects ordered by priority (and the free slots), valid for the same span as the grid. */
+static PriorityHeap_t priorityHeap;
+
+/** The cost matrix and the buffers of the global nearest neighbour association. */
+static AssignmentWorkspace_t assignmentWorkspace;
+
+/** The marginal association probabilities and the buffers of the JPDA association. */
+static JpdaWorkspace_t jpdaWorkspace;
+
+/** The fused object that each object ID of each sensor was last associated with. */
+static AssociationHint_t associationHints[NUM_SENSORS][NUM_SENSOR_OBJECT_IDS];
+
+/** Whether the gating values of each prefused object have been calculated in this cycle. */
+static u8_t plotGated[NUM_PREFUSED_OBJ];
+
+/** The number of the sensors of the configuration, that an object can be seen by. */
+static u8_t numSensors;
 
 /************************ Static Function Prototypes *************************/
 
@@ -52,7 +93,7 @@ static f32_t totalGatingValueMinLimit;
   *       For example, use the damped oscillation (exponential) function to approximate the behaviour during calibration.
   * @return The confidence value that was calculated.
   */
-static f32_t GetBearingConfidence(const f32_t targetX, const f32_t targetY, const Sensor_t* sensor);
+static real_t GetBearingConfidence(const real_t targetX, const real_t targetY, const Sensor_t* sensor);
 
 /**
   * @brief Transforms the prefused object from its sensor's coordinates to the global ones.
@@ -66,97 +107,193 @@ static void ApplySensorTF(PrefusedObject_t* prefusedObjectList);
 /**
   * @brief Resets a fused object.
   * @details All the attributes of a fused object (id, track, counters etc.) are set to zero/default.
-  * @param fusedObject A fused object that is outputted from the algo.
+  * @param fusedObjectStore The store of the fused objects (output of algo).
+  * @param index The index of the object in the fused object store.
   * @return Void.
   */
-static void ResetFusedObject(FusedObject_t* fusedObject);
+static void ResetFusedObject(FusedObjectStore_t* fusedObjectStore, const u8_t index);
 
 /**
   * @brief Creates an object in the fused object list from a prefused object.
   * @details Generates a new id for the object and initializes the track.
   *          If the fused object list is full and every fused object has a higher priority
   *          that the prefused object's priority, then no action is taken.
-  * @param fusedObjectList A list containing the fused objects (output of algo).
+  *          If no ID is free, no action is taken either and the slot is left free.
+  * @param fusedObjectStore The store of the fused objects (output of algo).
   * @param prefusedObject A prefused object used as an input to the algo.
   * @return Void.
   */
-static void CreateFusedObject(FusedObject_t* fusedObjectList, const PrefusedObject_t* prefusedObject);
+static void CreateFusedObject(FusedObjectStore_t* fusedObjectStore, const PrefusedObject_t* prefusedObject);
 
 /**
   * @brief Finds the worst priority in the fused object list.
-  * @details Finds the worst priority of all the valid fused objects and the index of the object holding it.
-  *          If the list contains no valid object, the minimum default priority is returned. 
-  * @param fusedObjectList A list containing the fused objects (output of algo).
-  * @param objectIndex The index in the fusedObjectList where the object with the worst priority is located.
+  * @details If the list has a free slot, the minimum default priority is returned with the first free index.
+  *          Else, the worst priority of all the valid fused objects and the index of the object holding it
+  *          are taken from the top of the priority heap (the lowest index on equal priorities).
+  * @param fusedObjectStore The store of the fused objects (output of algo).
+  * @param objectIndex The index in the fused object store where the object with the worst priority is located.
   * @return The lowest priority of all objects.
   */
-static f32_t GetWorstPriority(const FusedObject_t* fusedObjectList, u8_t* objectIndex);
+static real_t GetWorstPriority(const FusedObjectStore_t* fusedObjectStore, u8_t* objectIndex);
 
 /**
-  * @brief Get the first available id in the fused object list.
-  * @details For each valid id, searches if that id is used by an object.
-  *          If not valid id is found, an invalid (default) id is returned.
-  * @warning An invalid id should be never returned. This function is normally called
-  *          when the object list has a free slot or an object has been just deleted.
-  * @param fusedObjectList A list containing the fused objects (output of algo).
-  * @todo Make current available id static so all the id are recycled.
-  * @return The available id found.
+  * @brief Checks if the prefused oject is inside any of the acceptance gates of all fused object.
+  * @details For all valid fused objects, checks if the gating value is above a limit and finds the best pair.
+  *          If a pair (fused object) is found, its index in the fused object list is also returned.
+  *          Only the objects of the track grid cells that the acceptance gate can reach are checked.
+  *          On equal gating values, the object with the lowest index is paired.
+  *          The gating values of the tracks changed since the prefused object was gated are recalculated first.
+  * @param prefusedObject A prefused object used as an input to the algo.
+  * @param fusedObjectStore The store of the fused objects (output of algo).
+  * @param gatingValues The gating values of the prefused object (from `GatePrefusedObjects`).
+  * @param pairIndex The index in the fused object store where an object is paired with the prefusedObject.
+  * @return Whether the prefused object passes the acceptance gate or not.
   */
-static u8_t GetAvailableId(const FusedObject_t* fusedObjectList);
+static u8_t IsInsideAcceptanceGate(const PrefusedObject_t* prefusedObject, const FusedObjectStore_t* fusedObjectStore, real_t* gatingValues, u8_t* pairIndex);
 
 /**
-  * @brief Determine if the id is in use inside the fused object list.
-  * @details Cycles through all the fused objects to check if the id is in use.
-  * @param fusedObjectList A list containing the fused objects (output of algo).
-  * @param id The id to be checked if used inside the fusedObjectList.
-  * @return Whether the id is used or not.
+  * @brief Checks if the prefused object is inside the acceptance gate of the fused object that its sensor object ID was last associated with.
+  * @details The hint is followed only if the hinted fused object has not been replaced since.
+  *          A fused object may be replaced by a new one at the same index with the same (reused) ID,
+  *          so the hinted object must still pass the acceptance gate like any other pair.
+  * @param prefusedObject A prefused object used as an input to the algo.
+  * @param fusedObjectStore The store of the fused objects (output of algo).
+  * @param pairIndex The index in the fused object store of the hinted object.
+  * @return Whether the prefused object passes the acceptance gate of the hinted object or not.
   */
-static u8_t IsIdUsed(const FusedObject_t* fusedObjectList, const u8_t id);
+static u8_t IsInsideHintedGate(const PrefusedObject_t* prefusedObject, const FusedObjectStore_t* fusedObjectStore, u8_t* pairIndex);
 
 /**
-  * @brief Checks if the prefused oject is inside any of the acceptance gates of all fused object.
-  * @details For all valid fused objects, checks if the gating value is above a limit and finds the best pair.
-  *          If a pair (fused object) is found, its index in the fused object list is also returned.
+  * @brief Gets the association hint of the sensor object ID of a prefused object.
   * @param prefusedObject A prefused object used as an input to the algo.
-  * @param fusedObjectList A list containing the fused objects (output of algo).
-  * @param pairIndex The index in the fusedObjectList where an object is paired with the prefusedObject.
-  * @return Whether the prefused object passes the acceptance gate or not.
+  * @return The association hint, or NULL if the prefused object has no (valid) sensor object ID.
   */
-static u8_t IsInsideAcceptanceGate(const PrefusedObject_t* prefusedObject, const FusedObject_t* fusedObjectList, u8_t* pairIndex);
+static AssociationHint_t* GetAssociationHint(const PrefusedObject_t* prefusedObject);
 
 /**
-  * @brief Calculates the gating (comparison) value between a prefused and fused object.
-  * @details The gating value is the comparison between the track's (fused state) and the plot's (prefused state) Gaussians.
-  *          In particular, for each object, each state's (pos/vel) Gaussian is compared with the other object's state.
-  *          The sum of all the states' comparisons is returned. The more similar the objects, the higher the value is.
+  * @brief Remembers the fused object that a prefused object was associated with, for the next cycles.
   * @param prefusedObject A prefused object used as an input to the algo.
-  * @param fusedObject A fused object that is outputted from the algo.
-  * @return The calculated gating value.
+  * @param fusedObjectStore The store of the fused objects (output of algo).
+  * @param index The index in the fused object store of the associated object.
+  * @return Void.
+  */
+static void SetAssociationHint(const PrefusedObject_t* prefusedObject, const FusedObjectStore_t* fusedObjectStore, const u8_t index);
+
+/**
+  * @brief Gets the gating values of a prefused object, calculating them first if it was not gated along with the rest.
+  * @param prefusedObjectList A list containing the prefused objects (input of algo).
+  * @param index The index of the prefused object in the prefusedObjectList.
+  * @return The gating values of the prefused object.
   */
-static f32_t GetGatingValue(const PrefusedObject_t* prefusedObject, const FusedObject_t* fusedObject);
+static real_t* GetPrefusedGatingValues(const PrefusedObject_t* prefusedObjectList, const u8_t index);
+
+/**
+  * @brief Fuses a prefused object with its paired fused object.
+  * @details The fused object is marked as seen by the prefused object's sensor and is hinted for the prefused object's sensor object ID.
+  *          Depending on the update mode, the plot is fused immediately or accumulated until the end of the update step.
+  * @param prefusedObject A prefused object used as an input to the algo.
+  * @param fusedObjectStore The store of the fused objects (output of algo).
+  * @param pairIndex The index in the fused object store where the object paired with the prefusedObject is located.
+  * @return Void.
+  */
+static void FusePairedObject(const PrefusedObject_t* prefusedObject, FusedObjectStore_t* fusedObjectStore, const u8_t pairIndex);
+
+/**
+  * @brief Fills the row of the assignment cost matrix of a prefused object.
+  * @details The cost of each fused object inside the acceptance gate is its negated gating value.
+  *          The rest of the fused objects are forbidden, while the dummy columns (after the fused objects) can be always chosen.
+  *          The gating values of the tracks changed since the prefused object was gated are recalculated first.
+  * @param prefusedObject A prefused object used as an input to the algo.
+  * @param fusedObjectStore The store of the fused objects (output of algo).
+  * @param gatingValues The gating values of the prefused object (from `GatePrefusedObjects`).
+  * @param cost The row of the cost matrix.
+  * @param numDummies The number of the dummy columns.
+  * @return Void.
+  */
+static void SetAssignmentCosts(const PrefusedObject_t* prefusedObject, const FusedObjectStore_t* fusedObjectStore, real_t* gatingValues,
+                               real_t* cost, const u8_t numDummies);
+
+/**
+  * @brief Fills the assignment cost matrix with the prefused objects of a sensor, one row each.
+  * @param prefusedObjectList A list containing the prefused objects (input of algo).
+  * @param numPrefusedObjects The number of prefused objects (at the front of the list).
+  * @param sensorId The index of the sensor whose prefused objects are associated.
+  * @param fusedObjectStore The store of the fused objects (output of algo).
+  * @param plotIndex The index in the prefused object list of each row.
+  * @return The number of rows.
+  */
+static u8_t SetSensorAssignmentCosts(const PrefusedObject_t* prefusedObjectList, const u8_t numPrefusedObjects, const u8_t sensorId, const FusedObjectStore_t* fusedObjectStore, u8_t* plotIndex);
+
+/**
+  * @brief Merges the prefused objects of a sensor into one, weighted by their marginal probability of being paired with a fused object.
+  * @details The merged plot is the weighted mean of the plots, with the variance of each state grown by the spread of the plots around it.
+  *          Its weight is the sum of the weights of the plots times their probabilities, so that the innovation
+  *          is scaled by the probability of the fused object being detected (same as the PDA filter).
+  * @param prefusedObjectList A list containing the prefused objects (input of algo).
+  * @param plotIndex The index in the prefused object list of each row of the JPDA problem.
+  * @param rows The number of rows of the JPDA problem.
+  * @param pairIndex The index of the fused object.
+  * @param mergedObject The merged prefused object.
+  * @return Whether any prefused object may be paired with the fused object.
+  */
+static u8_t GetMergedObject(const PrefusedObject_t* prefusedObjectList, const u8_t* plotIndex, const u8_t rows, const u8_t pairIndex,
+                            PrefusedObject_t* mergedObject);
+
+/**
+  * @brief Gets the squared max distance in a position state that a plot can pass the acceptance gate from.
+  * @details A state passes the gate when weight * (varPlot + varTrack) / dist^2 > `STATE_GATING_VALUE_MIN_LIMIT`.
+  *          The variance of the track is bounded by the max variance of the tracks in the grid.
+  * @param prefusedObject A prefused object used as an input to the algo.
+  * @param axis The axis of the position state.
+  * @return The squared radius of the acceptance gate.
+  */
+static real_t GetGatingRadius2(const PrefusedObject_t* prefusedObject, const u8_t axis);
+
    
 /**
   * @brief Checks if the fused object is lost.
   * @details Sums the seen counter for all the sensors contained in this fused object.
   *          If the sum is equal to zero, this mean that the object is lost (not seen by any sensor).
-  * @param fusedObject A fused object that is outputted from the algo.
+  * @param fusedObjectStore The store of the fused objects (output of algo).
+  * @param index The index of the object in the fused object store.
   * @return Whether the object is lost or not.
   */
-static u8_t IsObjectLost(const FusedObject_t* fusedObject);
+static u8_t IsObjectLost(const FusedObjectStore_t* fusedObjectStore, const u8_t index);
 
 /**
   * @brief Checks if the fused object is coastable.
   * @details An object is coastable if its current lost counter has not exceeded the coasting limit.
   *          This means, that in the next cycle it will be predicted, even if no
   *          prefused (input) object is associated to it.
-  * @param fusedObject A fused object that is outputted from the algo.
+  * @param fusedObjectStore The store of the fused objects (output of algo).
+  * @param index The index of the object in the fused object store.
   * @return Whether the object is should be coasted or not.
   */
-static u8_t IsObjectCoastable(FusedObject_t* fusedObject);
+static u8_t IsObjectCoastable(const FusedObjectStore_t* fusedObjectStore, const u8_t index);
+
+/**
+  * @brief Sorts the indices of the fused objects by their position in x.
+  * @details A heapsort, so that the cost is O(N log N) without any extra memory.
+  * @param sorted The indices of the objects (sorted in place).
+  * @param numSorted The number of the indices.
+  * @param posX The position in x of each object (by its index).
+  * @return Void.
+  */
+static void SortObjectsByX(u8_t* sorted, const u8_t numSorted, const real_t* posX);
+
+/**
+  * @brief Moves an index down the max-heap of `SortObjectsByX`, until it is not before its children.
+  * @param sorted The indices of the objects (the heap).
+  * @param count The number of the indices in the heap.
+  * @param posX The position in x of each object (by its index).
+  * @param position The position of the index in the heap.
+  * @return Void.
+  */
+static void SiftObjectDown(u8_t* sorted, const u8_t count, const real_t* posX, u8_t position);
 
 /***************************** Static Functions ******************************/
 
-void InitializeFusionUtils(void)
+void InitializeFusionUtils(const AlgorithmConfig_t* config)
 {
     gatingWeights[STATE_X] = GATING_WEIGHT_X;
     gatingWeights[STATE_Y] = GATING_WEIGHT_Y;
@@ -164,13 +301,23 @@ void InitializeFusionUtils(void)
     gatingWeights[STATE_VY] = GATING_WEIGHT_VY;
     
     totalGatingValueMinLimit = KALMAN_STATES * STATE_GATING_VALUE_MIN_LIMIT * ACCEPTANCE_GATE_SUM_FACTOR;
+
+    numSensors = config->numSensors;
+
+    (void)memset(plotInformation, 0, sizeof(plotInformation));
+    (void)memset(associationHints, 0, sizeof(associationHints));
+    (void)memset(plotGated, 0, sizeof(plotGated));
+
+    ResetTrackGrid(&trackGrid);
+    ResetIdAllocator(&idAllocator, config->maxId);
+    ResetPriorityHeap(&priorityHeap, config->numFusedObjects);
 }
 
-f32_t GetBearingConfidence(const f32_t targetX, const f32_t targetY, const Sensor_t* sensor)
+real_t GetBearingConfidence(const real_t targetX, const real_t targetY, const Sensor_t* sensor)
 {
-    f32_t confidence;
-    f32_t sensorX, sensorY;
-    f32_t trueBearing, maxBearing, weakBearing, targetBearing;
+    real_t confidence;
+    real_t sensorX, sensorY;
+    real_t trueBearing, maxBearing, weakBearing, targetBearing;
 
     sensorX = targetX - sensor->tf.x;
     sensorY = targetY - sensor->tf.y;
@@ -178,7 +325,7 @@ f32_t GetBearingConfidence(const f32_t targetX, const f32_t targetY, const Senso
     trueBearing = 0.f;
     maxBearing = sensor->tf.fov / 2.f;
     weakBearing = maxBearing - SENSOR_WEAK_BEARING_AREA;
-    targetBearing = fabs(RAD2DEG(GetBearing(sensorX, sensorY)) - sensor->tf.mounting);
+    targetBearing = REAL_FABS(RAD2DEG(GetBearing(sensorX, sensorY)) - sensor->tf.mounting);
 
     if (targetBearing >= trueBearing && targetBearing <= weakBearing)
     {
@@ -202,186 +349,207 @@ void ApplySensorTF(PrefusedObject_t* prefusedObject)
     prefusedObject->plot.Z[STATE_Y] += prefusedObject->sensor->tf.canY;
 }
 
-void ResetFusedObject(FusedObject_t* fusedObject)
+void ResetFusedObject(FusedObjectStore_t* fusedObjectStore, const u8_t index)
 {
-    fusedObject->id = INVALID_ID;
-
-    (void)memset(&fusedObject->track, 0, sizeof(Track_t));
+    FreeId(&idAllocator, fusedObjectStore->hot[index].id);
 
-    fusedObject->lifetimeCounter = 0u;
-    (void)memset(fusedObject->seenThisCycle, 0, sizeof(u8_t) * NUM_SENSORS);
-    fusedObject->lostCounter = 0u;
+    (void)memset(&fusedObjectStore->hot[index], 0, sizeof(FusedObjectHot_t));
+    (void)memset(&fusedObjectStore->cold[index], 0, sizeof(FusedObjectCold_t));
 
-    fusedObject->priority = 0.f;
+    SetFusedObjectLive(fusedObjectStore, index, FALSE);
 }
 
-void CreateFusedObject(FusedObject_t* fusedObjectList, const PrefusedObject_t* prefusedObject)
+void CreateFusedObject(FusedObjectStore_t* fusedObjectStore, const PrefusedObject_t* prefusedObject)
 {
-    u8_t index;
+    u8_t index = 0u;
 
-    if (prefusedObject->priority > GetWorstPriority(fusedObjectList, &index))
+    if (prefusedObject->priority > GetWorstPriority(fusedObjectStore, &index))
     {
-        if (fusedObjectList[index].id != INVALID_ID)
+        if (fusedObjectStore->hot[index].id != INVALID_ID)
         {
-            ResetFusedObject(&fusedObjectList[index]);
+            RemoveHeapObject(&priorityHeap, fusedObjectStore, index);
+            ResetFusedObject(fusedObjectStore, index);
         }
 
-        fusedObjectList[index].id = GetAvailableId(fusedObjectList);
+        fusedObjectStore->hot[index].id = AllocateId(&idAllocator);
 
-        InitializeTrack(&fusedObjectList[index].track, &prefusedObject->plot);
+        /* Without an ID the slot is left free, out of the grid, the gating tracks and the heap. */
+        if (fusedObjectStore->hot[index].id != INVALID_ID)
+        {
+            /* Plots accumulated for a replaced object must not be fused with the new one. */
+            (void)memset(&plotInformation[index], 0, sizeof(PlotInformation_t));
+
+            SetFusedObjectLive(fusedObjectStore, index, TRUE);
+
+            InitializeTrack(&fusedObjectStore->cold[index].track, &prefusedObject->plot);
+            UpdateHotFusedObject(fusedObjectStore, index);
+
+            RemoveGridTrack(&trackGrid, index);
+            InsertGridTrack(&trackGrid, index, fusedObjectStore->hot[index].X, fusedObjectStore->hot[index].variance);
+            SetGatingTrack(&gatingTracks, index, fusedObjectStore->hot[index].X, fusedObjectStore->hot[index].variance, gatingWeights);
+            InsertHeapObject(&priorityHeap, fusedObjectStore, index);
+
+            SetAssociationHint(prefusedObject, fusedObjectStore, index);
+        }
     }
 }
 
-f32_t GetWorstPriority(const FusedObject_t* fusedObjectList, u8_t* objectIndex)
+real_t GetWorstPriority(const FusedObjectStore_t* fusedObjectStore, u8_t* objectIndex)
 {
-    u8_t i;
-    f32_t worstPriority = MAX_PRIORITY;
+    u8_t index;
+    real_t worstPriority = MAX_PRIORITY;
 
-    for (i = 0u; i < NUM_FUSED_OBJ; i++)
+    index = GetHeapFreeSlot(&priorityHeap);
+
+    if (index < NUM_FUSED_OBJ)
     {
-        if (fusedObjectList[i].id != INVALID_ID)
-        {
-            if (fusedObjectList[i].priority < worstPriority)
-            {
-                worstPriority = fusedObjectList[i].priority;
-                *objectIndex = i;
-            }
-        }
-        else
-        {
-            worstPriority = (-1.f) * MAX_PRIORITY;
-            *objectIndex = i;
+        worstPriority = (-1.f) * MAX_PRIORITY;
+        *objectIndex = index;
+    }
+    else
+    {
+        index = GetHeapMinObject(&priorityHeap);
 
-            break;
+        if ((index < NUM_FUSED_OBJ) && (fusedObjectStore->hot[index].priority < worstPriority))
+        {
+            worstPriority = fusedObjectStore->hot[index].priority;
+            *objectIndex = index;
         }
     }
 
     return worstPriority;
 }
 
-u8_t GetAvailableId(const FusedObject_t* fusedObjectList)
+u8_t IsInsideAcceptanceGate(const PrefusedObject_t* prefusedObject, const FusedObjectStore_t* fusedObjectStore, real_t* gatingValues, u8_t* pairIndex)
 {
-    u8_t tentId;
-    u8_t availId = INVALID_ID;
+    u8_t i, j, numCandidates;
+    u8_t candidates[NUM_FUSED_OBJ];
+    real_t bestGatingValue, gatingValue;
     
-    for (tentId = (INVALID_ID + 1u); tentId < MAX_ID; tentId++)
+    bestGatingValue = INVALID_GATING_VALUE;
+
+    UpdateGatingValues(&gatingTracks, &prefusedObject->plot, gatingWeights, gatingValues);
+
+    numCandidates = GetGridCandidates(&trackGrid,
+        prefusedObject->plot.Z[STATE_X], prefusedObject->plot.Z[STATE_Y],
+        GetGatingRadius2(prefusedObject, AXIS_X), GetGatingRadius2(prefusedObject, AXIS_Y),
+        candidates);
+
+    for (j = 0u; j < numCandidates; j++)
     {
-        if (!IsIdUsed(fusedObjectList, tentId))
+        i = candidates[j];
+
+        if (fusedObjectStore->hot[i].id != INVALID_ID)
         {
-            availId = tentId;
-            break;
+            gatingValue = gatingValues[i];
+
+            if ((gatingValue > bestGatingValue) ||
+                ((gatingValue == bestGatingValue) && (i < *pairIndex)))
+            {
+                *pairIndex = i;
+                bestGatingValue = gatingValue;
+            }
         }
     }
 
-    return availId;
+    return (bestGatingValue > totalGatingValueMinLimit);
 }
 
-u8_t IsIdUsed(const FusedObject_t* fusedObjectList, const u8_t id)
+u8_t IsInsideHintedGate(const PrefusedObject_t* prefusedObject, const FusedObjectStore_t* fusedObjectStore, u8_t* pairIndex)
 {
-    u8_t i;
-    u8_t isUsed = FALSE;
+    u8_t inside = FALSE;
+    const AssociationHint_t* hint = GetAssociationHint(prefusedObject);
 
-    for (i = 0u; i < NUM_FUSED_OBJ; i++)
+    if ((hint != NULL) && (hint->id != INVALID_ID) && (fusedObjectStore->hot[hint->index].id == hint->id))
     {
-        if (fusedObjectList[i].id == id)
+        if (GetGatingValue(&gatingTracks, hint->index, &prefusedObject->plot, gatingWeights) > totalGatingValueMinLimit)
         {
-            isUsed = TRUE;
-            break;
+            *pairIndex = hint->index;
+            inside = TRUE;
         }
     }
 
-    return isUsed;
+    return inside;
 }
 
-u8_t IsInsideAcceptanceGate(const PrefusedObject_t* prefusedObject, const FusedObject_t* fusedObjectList, u8_t* pairIndex)
+AssociationHint_t* GetAssociationHint(const PrefusedObject_t* prefusedObject)
 {
-    u8_t i;
-    f32_t bestGatingValue, gatingValue;
-    
-    bestGatingValue = INVALID_GATING_VALUE;
+    AssociationHint_t* hint = NULL;
 
-    for (i = 0u; i < NUM_FUSED_OBJ; i++)
+    if ((prefusedObject->sensorObjectId != NO_SENSOR_OBJECT_ID) && (prefusedObject->sensorObjectId < NUM_SENSOR_OBJECT_IDS) &&
+        (prefusedObject->sensor->id < NUM_SENSORS))
     {
-        if (fusedObjectList[i].id != INVALID_ID)
-        {
-            gatingValue = GetGatingValue(prefusedObject, &fusedObjectList[i]);
-
-            if (gatingValue > bestGatingValue)
-            {
-                *pairIndex = i;
-                bestGatingValue = gatingValue;
-            }
-        }
+        hint = &associationHints[prefusedObject->sensor->id][prefusedObject->sensorObjectId];
     }
 
-    return (bestGatingValue > totalGatingValueMinLimit);
+    return hint;
 }
 
-f32_t GetGatingValue(const PrefusedObject_t* prefusedObject, const FusedObject_t* fusedObject)
+void SetAssociationHint(const PrefusedObject_t* prefusedObject, const FusedObjectStore_t* fusedObjectStore, const u8_t index)
 {
-    u8_t i;
-    f32_t similarityValue;
-    f32_t gatingValue = 0.f;
-    
-    for (i = 0u; i < KALMAN_STATES; i++)
+    AssociationHint_t* hint = GetAssociationHint(prefusedObject);
+
+    if (hint != NULL)
     {
-        similarityValue = GetSimilarityValue(
-            prefusedObject->plot.Z[i],
-            fusedObject->track.X[i],
-            prefusedObject->plot.R[(KALMAN_STATES * i) + i],
-            fusedObject->track.P[(KALMAN_STATES * i) + i]);
+        hint->index = index;
+        hint->id = fusedObjectStore->hot[index].id;
+    }
+}
 
-        similarityValue *= gatingWeights[i];
-    
-        if (similarityValue > STATE_GATING_VALUE_MIN_LIMIT)
-        {
-            gatingValue += similarityValue;
-        }
-        else
-        {
-            gatingValue = INVALID_GATING_VALUE;
-            break;
-        }
+real_t* GetPrefusedGatingValues(const PrefusedObject_t* prefusedObjectList, const u8_t index)
+{
+    if (!plotGated[index])
+    {
+        GetGatingValues(&gatingTracks, &prefusedObjectList[index].plot, gatingWeights, plotGatingValues[index]);
+
+        plotGated[index] = TRUE;
     }
 
-    return gatingValue;
+    return plotGatingValues[index];
 }
 
-u8_t IsObjectLost(const FusedObject_t* fusedObject)
+real_t GetGatingRadius2(const PrefusedObject_t* prefusedObject, const u8_t axis)
+{
+    u8_t state = GET_STATE_FROM_AXIS(axis, 0u);
+
+    return (gatingWeights[state] *
+        (prefusedObject->plot.R[(KALMAN_STATES * state) + state] + trackGrid.maxVariance[axis]) / STATE_GATING_VALUE_MIN_LIMIT);
+}
+
+u8_t IsObjectLost(const FusedObjectStore_t* fusedObjectStore, const u8_t index)
 {
     u8_t i;
     u16_t seenSum = 0u;
 
-    for (i = 0u; i < (sizeof(fusedObject->seenThisCycle) / sizeof(u8_t)); i++)
+    for (i = 0u; i < numSensors; i++)
     {
-        seenSum += fusedObject->seenThisCycle[i];
+        seenSum += fusedObjectStore->hot[index].seenThisCycle[i];
     }
 
     return (seenSum == 0u);
 }
 
-u8_t IsObjectCoastable(FusedObject_t* fusedObject)
+u8_t IsObjectCoastable(const FusedObjectStore_t* fusedObjectStore, const u8_t index)
 {
-    return (fusedObject->lostCounter <= MAX_COASTING_CYCLES);
+    return (fusedObjectStore->hot[index].lostCounter <= MAX_COASTING_CYCLES);
 }
 
 /***************************** Public Functions ******************************/
 
-f32_t GetObjectPriority(const f32_t dist_x, const f32_t dist_y)
+real_t GetObjectPriority(const real_t dist_x, const real_t dist_y)
 {
     return (MAX_PRIORITY - GetRange(dist_x, dist_y));
 }
 
-void CreatePrefusedObject(PrefusedObject_t* prefusedObject, const Sensor_t* pSensor, f32_t posX, f32_t posY, f32_t velX, f32_t velY)
+void CreatePrefusedObject(PrefusedObject_t* prefusedObject, const Sensor_t* pSensor, real_t posX, real_t posY, real_t velX, real_t velY)
 {
-    f32_t varRange = SIGMA_RANGE * SIGMA_RANGE;
-    f32_t varDoppler = SIGMA_DOPPLER * SIGMA_DOPPLER;
-    f32_t varBearing = DEG2RAD(SIGMA_BEARING) * DEG2RAD(SIGMA_BEARING);
-    f32_t varBase = SIGMA_BASE * SIGMA_BASE;
-
-    prefusedObject->valid = TRUE;
+    real_t varRange = SIGMA_RANGE * SIGMA_RANGE;
+    real_t varDoppler = SIGMA_DOPPLER * SIGMA_DOPPLER;
+    real_t varBearing = DEG2RAD(SIGMA_BEARING) * DEG2RAD(SIGMA_BEARING);
+    real_t varBase = SIGMA_BASE * SIGMA_BASE;
 
     prefusedObject->sensor = pSensor;
+    prefusedObject->sensorObjectId = NO_SENSOR_OBJECT_ID;
 
     prefusedObject->plot.Z[STATE_X] = posX;
     prefusedObject->plot.Z[STATE_Y] = posY;
@@ -400,75 +568,474 @@ void CreatePrefusedObject(PrefusedObject_t* prefusedObject, const Sensor_t* pSen
     prefusedObject->priority = GetObjectPriority(prefusedObject->plot.Z[STATE_X], prefusedObject->plot.Z[STATE_Y]);
 }
 
-void AssociatePrefusedObject(const PrefusedObject_t* prefusedObject, FusedObject_t* fusedObjectList)
+void AssociatePrefusedObject(const PrefusedObject_t* prefusedObjectList, const u8_t index, FusedObjectStore_t* fusedObjectStore)
+{
+    u8_t pairIndex = 0u;
+    const PrefusedObject_t* prefusedObject = &prefusedObjectList[index];
+
+    if (IsInsideHintedGate(prefusedObject, fusedObjectStore, &pairIndex) ||
+        IsInsideAcceptanceGate(prefusedObject, fusedObjectStore, GetPrefusedGatingValues(prefusedObjectList, index), &pairIndex))
+    {
+        FusePairedObject(prefusedObject, fusedObjectStore, pairIndex);
+    }
+    else
+    {
+        CreateFusedObject(fusedObjectStore, prefusedObject);
+    }
+}
+
+void AssociateSensorObjects(const PrefusedObject_t* prefusedObjectList, const u8_t numPrefusedObjects, const u8_t sensorId, FusedObjectStore_t* fusedObjectStore)
+{
+    u8_t i, rows;
+    u8_t plotIndex[MAX_ASSIGNMENT_ROWS];
+    u8_t assignment[MAX_ASSIGNMENT_ROWS];
+
+    rows = SetSensorAssignmentCosts(prefusedObjectList, numPrefusedObjects, sensorId, fusedObjectStore, plotIndex);
+
+    if (rows > 0u)
+    {
+        SolveAssignment(&assignmentWorkspace, rows, NUM_FUSED_OBJ + rows, assignment);
+
+        /* Fuse all the pairs first, so that a created object never replaces a paired one. */
+        for (i = 0u; i < rows; i++)
+        {
+            if (assignment[i] < NUM_FUSED_OBJ)
+            {
+                FusePairedObject(&prefusedObjectList[plotIndex[i]], fusedObjectStore, assignment[i]);
+            }
+        }
+
+        for (i = 0u; i < rows; i++)
+        {
+            if (assignment[i] >= NUM_FUSED_OBJ)
+            {
+                CreateFusedObject(fusedObjectStore, &prefusedObjectList[plotIndex[i]]);
+            }
+        }
+    }
+}
+
+void AssociateSensorHypotheses(const PrefusedObject_t* prefusedObjectList, const u8_t numPrefusedObjects, const u8_t sensorId, FusedObjectStore_t* fusedObjectStore,
+                               AssociationStats_t* stats)
+{
+    u8_t i, j, rows;
+    u8_t numFallbacks = 0u;
+    u8_t create;
+    u8_t plotIndex[MAX_ASSIGNMENT_ROWS];
+    u8_t assignment[MAX_ASSIGNMENT_ROWS];
+    PrefusedObject_t mergedObject;
+
+    rows = SetSensorAssignmentCosts(prefusedObjectList, numPrefusedObjects, sensorId, fusedObjectStore, plotIndex);
+
+    if (rows > 0u)
+    {
+        SolveJpda(&jpdaWorkspace, assignmentWorkspace.cost, rows, totalGatingValueMinLimit, JPDA_MAX_HYPOTHESES, stats);
+
+        for (i = 0u; i < rows; i++)
+        {
+            numFallbacks += jpdaWorkspace.fallback[i];
+        }
+
+        /* The clusters are independent, so the optimum of the whole problem is the optimum of each abandoned cluster. */
+        if (numFallbacks > 0u)
+        {
+            SolveAssignment(&assignmentWorkspace, rows, NUM_FUSED_OBJ + rows, assignment);
+        }
+
+        /* Fuse all the pairs first, so that a created object never replaces a paired one. */
+        for (j = 0u; j < NUM_FUSED_OBJ; j++)
+        {
+            if (GetMergedObject(prefusedObjectList, plotIndex, rows, j, &mergedObject))
+            {
+                FusePairedObject(&mergedObject, fusedObjectStore, j);
+            }
+        }
+
+        for (i = 0u; i < rows; i++)
+        {
+            if (jpdaWorkspace.fallback[i] && (assignment[i] < NUM_FUSED_OBJ))
+            {
+                FusePairedObject(&prefusedObjectList[plotIndex[i]], fusedObjectStore, assignment[i]);
+            }
+        }
+
+        for (i = 0u; i < rows; i++)
+        {
+            if (jpdaWorkspace.fallback[i])
+            {
+                create = (assignment[i] >= NUM_FUSED_OBJ);
+            }
+            else
+            {
+                create = TRUE;
+
+                for (j = 0u; j < NUM_FUSED_OBJ; j++)
+                {
+                    if (jpdaWorkspace.marginal[i][j] >= jpdaWorkspace.marginal[i][JPDA_NONE_COL])
+                    {
+                        create = FALSE;
+                    }
+                }
+            }
+
+            if (create)
+            {
+                CreateFusedObject(fusedObjectStore, &prefusedObjectList[plotIndex[i]]);
+            }
+        }
+    }
+}
+
+u8_t SetSensorAssignmentCosts(const PrefusedObject_t* prefusedObjectList, const u8_t numPrefusedObjects, const u8_t sensorId, const FusedObjectStore_t* fusedObjectStore, u8_t* plotIndex)
 {
-    u8_t pairIndex;
+    u8_t i, rows = 0u;
 
-    if (IsInsideAcceptanceGate(prefusedObject, fusedObjectList, &pairIndex))
+    for (i = 0u; i < numPrefusedObjects; i++)
     {
-        fusedObjectList[pairIndex].seenThisCycle[prefusedObject->sensor->type] = 1;
+        if (prefusedObjectList[i].sensor->id == sensorId)
+        {
+            plotIndex[rows] = i;
+            rows++;
+        }
+    }
 
-        FuseTrack(&fusedObjectList[pairIndex].track, &prefusedObject->plot);
+    for (i = 0u; i < rows; i++)
+    {
+        SetAssignmentCosts(&prefusedObjectList[plotIndex[i]], fusedObjectStore, GetPrefusedGatingValues(prefusedObjectList, plotIndex[i]),
+                           assignmentWorkspace.cost[i], rows);
+    }
+
+    return rows;
+}
+
+u8_t GetMergedObject(const PrefusedObject_t* prefusedObjectList, const u8_t* plotIndex, const u8_t rows, const u8_t pairIndex,
+                     PrefusedObject_t* mergedObject)
+{
+    u8_t i, j, diagonal;
+    real_t probability, sumProbability = 0.f, spread;
+    const Plot_t* plot;
+
+    for (i = 0u; i < rows; i++)
+    {
+        probability = jpdaWorkspace.marginal[i][pairIndex];
+
+        if (probability > 0.f)
+        {
+            if (sumProbability == 0.f)
+            {
+                *mergedObject = prefusedObjectList[plotIndex[i]];
+                mergedObject->sensorObjectId = NO_SENSOR_OBJECT_ID;
+                (void)memset(&mergedObject->plot, 0, sizeof(Plot_t));
+            }
+
+            plot = &prefusedObjectList[plotIndex[i]].plot;
+            sumProbability += probability;
+
+            for (j = 0u; j < KALMAN_STATES; j++)
+            {
+                mergedObject->plot.Z[j] += probability * plot->Z[j];
+            }
+
+            mergedObject->plot.weight += probability * plot->weight;
+        }
+    }
+
+    if (sumProbability > 0.f)
+    {
+        for (j = 0u; j < KALMAN_STATES; j++)
+        {
+            mergedObject->plot.Z[j] /= sumProbability;
+        }
+
+        for (i = 0u; i < rows; i++)
+        {
+            probability = jpdaWorkspace.marginal[i][pairIndex];
+
+            if (probability > 0.f)
+            {
+                plot = &prefusedObjectList[plotIndex[i]].plot;
+
+                for (j = 0u; j < KALMAN_STATES; j++)
+                {
+                    diagonal = (KALMAN_STATES * j) + j;
+                    spread = plot->Z[j] - mergedObject->plot.Z[j];
+
+                    mergedObject->plot.R[diagonal] += (probability / sumProbability) * (plot->R[diagonal] + (spread * spread));
+                }
+            }
+        }
+    }
+
+    return (sumProbability > 0.f);
+}
+
+void FusePairedObject(const PrefusedObject_t* prefusedObject, FusedObjectStore_t* fusedObjectStore, const u8_t pairIndex)
+{
+    /* The plots of the sensors outside the configuration are never added (see `AddInputObject`). */
+    if (prefusedObject->sensor->id < numSensors)
+    {
+        fusedObjectStore->hot[pairIndex].seenThisCycle[prefusedObject->sensor->id] = 1;
+    }
+
+    SetAssociationHint(prefusedObject, fusedObjectStore, pairIndex);
+
+    if (UPDATE_MODE == UPDATE_MODE_INFORMATION)
+    {
+        AccumulatePlotInformation(&plotInformation[pairIndex], &prefusedObject->plot);
     }
     else
     {
-        CreateFusedObject(fusedObjectList, prefusedObject);
+        FuseTrack(&fusedObjectStore->cold[pairIndex].track, &prefusedObject->plot);
+        UpdateHotFusedObject(fusedObjectStore, pairIndex);
+
+        MoveGridTrack(&trackGrid, pairIndex, fusedObjectStore->hot[pairIndex].X, fusedObjectStore->hot[pairIndex].variance);
+        SetGatingTrack(&gatingTracks, pairIndex, fusedObjectStore->hot[pairIndex].X, fusedObjectStore->hot[pairIndex].variance, gatingWeights);
+    }
+}
+
+void SetAssignmentCosts(const PrefusedObject_t* prefusedObject, const FusedObjectStore_t* fusedObjectStore, real_t* gatingValues,
+                        real_t* cost, const u8_t numDummies)
+{
+    u8_t i, j, numCandidates;
+    u8_t candidates[NUM_FUSED_OBJ];
+
+    for (i = 0u; i < NUM_FUSED_OBJ; i++)
+    {
+        cost[i] = FORBIDDEN_ASSIGNMENT_COST;
+    }
+
+    for (i = 0u; i < numDummies; i++)
+    {
+        cost[NUM_FUSED_OBJ + i] = DUMMY_ASSIGNMENT_COST;
+    }
+
+    UpdateGatingValues(&gatingTracks, &prefusedObject->plot, gatingWeights, gatingValues);
+
+    numCandidates = GetGridCandidates(&trackGrid,
+        prefusedObject->plot.Z[STATE_X], prefusedObject->plot.Z[STATE_Y],
+        GetGatingRadius2(prefusedObject, AXIS_X), GetGatingRadius2(prefusedObject, AXIS_Y),
+        candidates);
+
+    for (j = 0u; j < numCandidates; j++)
+    {
+        i = candidates[j];
+
+        if (fusedObjectStore->hot[i].id != INVALID_ID)
+        {
+            if (gatingValues[i] > totalGatingValueMinLimit)
+            {
+                cost[i] = -gatingValues[i];
+            }
+        }
+    }
+}
+
+void BuildTrackGrid(const FusedObjectStore_t* fusedObjectStore)
+{
+    u8_t i;
+
+    ResetTrackGrid(&trackGrid);
+
+    for (i = GetNextLiveFusedObject(fusedObjectStore, 0u); i < NUM_FUSED_OBJ; i = GetNextLiveFusedObject(fusedObjectStore, i + 1u))
+    {
+        InsertGridTrack(&trackGrid, i, fusedObjectStore->hot[i].X, fusedObjectStore->hot[i].variance);
+        SetGatingTrack(&gatingTracks, i, fusedObjectStore->hot[i].X, fusedObjectStore->hot[i].variance, gatingWeights);
+    }
+}
+
+void BuildEvictionHeap(const FusedObjectStore_t* fusedObjectStore)
+{
+    BuildPriorityHeap(&priorityHeap, fusedObjectStore);
+}
+
+void GatePrefusedObjects(const PrefusedObject_t* prefusedObjectList, const u8_t numPrefusedObjects)
+{
+    u8_t i;
+    const AssociationHint_t* hint;
+
+    for (i = 0u; i < numPrefusedObjects; i++)
+    {
+        hint = GetAssociationHint(&prefusedObjectList[i]);
+
+        plotGated[i] = !((ASSOCIATION_MODE == ASSOCIATION_MODE_GREEDY) && (hint != NULL) && (hint->id != INVALID_ID));
     }
+
+    GetPlotGatingValues(&gatingTracks, prefusedObjectList, numPrefusedObjects, plotGated, gatingWeights, plotGatingValues);
+    ClearGatingChanges(&gatingTracks);
 }
 
-void CheckObjectsForPruning(FusedObject_t* fusedObject1, FusedObject_t* fusedObject2)
+void FuseAccumulatedPlots(FusedObjectStore_t* fusedObjectStore)
 {
-    FusedObject_t* objectToPrune;
+    u8_t i;
 
-    if (((f32_t)(fabs(fusedObject1->track.X[STATE_X] - fusedObject2->track.X[STATE_X])) <= PRUNE_LIMIT_X) &&
-        ((f32_t)(fabs(fusedObject1->track.X[STATE_Y] - fusedObject2->track.X[STATE_Y])) <= PRUNE_LIMIT_Y) &&
-        ((f32_t)(fabs(fusedObject1->track.X[STATE_VX] - fusedObject2->track.X[STATE_VX])) <= PRUNE_LIMIT_VX) &&
-        ((f32_t)(fabs(fusedObject1->track.X[STATE_VY] - fusedObject2->track.X[STATE_VY])) <= PRUNE_LIMIT_VY))
+    /* Plots are only accumulated for live objects (a replaced object has its plots cleared). */
+    for (i = GetNextLiveFusedObject(fusedObjectStore, 0u); i < NUM_FUSED_OBJ; i = GetNextLiveFusedObject(fusedObjectStore, i + 1u))
     {
-        if (fusedObject1->priority > fusedObject2->priority)
+        if (plotInformation[i].count > 0u)
         {
-            objectToPrune = fusedObject2;
+            FusePlotInformation(&fusedObjectStore->cold[i].track, &plotInformation[i]);
+            UpdateHotFusedObject(fusedObjectStore, i);
+
+            (void)memset(&plotInformation[i], 0, sizeof(PlotInformation_t));
+        }
+    }
+}
+
+void CheckObjectsForPruning(FusedObjectStore_t* fusedObjectStore, const u8_t index1, const u8_t index2)
+{
+    u8_t objectToPrune;
+    const real_t* X1 = fusedObjectStore->hot[index1].X;
+    const real_t* X2 = fusedObjectStore->hot[index2].X;
+
+    if ((REAL_FABS(X1[STATE_X] - X2[STATE_X]) <= PRUNE_LIMIT_X) &&
+        (REAL_FABS(X1[STATE_Y] - X2[STATE_Y]) <= PRUNE_LIMIT_Y) &&
+        (REAL_FABS(X1[STATE_VX] - X2[STATE_VX]) <= PRUNE_LIMIT_VX) &&
+        (REAL_FABS(X1[STATE_VY] - X2[STATE_VY]) <= PRUNE_LIMIT_VY))
+    {
+        if (fusedObjectStore->hot[index1].priority > fusedObjectStore->hot[index2].priority)
+        {
+            objectToPrune = index2;
         }
         else
         {
-            objectToPrune = fusedObject1;
+            objectToPrune = index1;
         }
 
-        ResetFusedObject(objectToPrune);
+        ResetFusedObject(fusedObjectStore, objectToPrune);
     }
 }
 
-void MaintainObject(FusedObject_t* fusedObject)
+void SortObjectsByX(u8_t* sorted, const u8_t numSorted, const real_t* posX)
 {
-    fusedObject->lifetimeCounter = (fusedObject->lifetimeCounter + 1) % U16_MAX;
+    u8_t i, index;
+
+    for (i = (numSorted / 2u); i > 0u; i--)
+    {
+        SiftObjectDown(sorted, numSorted, posX, i - 1u);
+    }
+
+    for (i = numSorted; i > 1u; i--)
+    {
+        index = sorted[0];
+        sorted[0] = sorted[i - 1u];
+        sorted[i - 1u] = index;
+
+        SiftObjectDown(sorted, i - 1u, posX, 0u);
+    }
+}
+
+void SiftObjectDown(u8_t* sorted, const u8_t count, const real_t* posX, u8_t position)
+{
+    u16_t child = (2u * (u16_t)position) + 1u;
+    u8_t index;
+
+    while (child < count)
+    {
+        if (((child + 1u) < count) && (posX[sorted[child + 1u]] > posX[sorted[child]]))
+        {
+            child++;
+        }
+
+        if (posX[sorted[child]] <= posX[sorted[position]])
+        {
+            break;
+        }
+
+        index = sorted[position];
+        sorted[position] = sorted[child];
+        sorted[child] = index;
+
+        position = (u8_t)child;
+        child = (2u * (u16_t)position) + 1u;
+    }
+}
+
+void PruneObjects(FusedObjectStore_t* fusedObjectStore)
+{
+    u8_t i, j, numSorted = 0u;
+    u8_t object1, object2;
+    u32_t neighbour;
+    u8_t sorted[NUM_FUSED_OBJ];
+    real_t posX[NUM_FUSED_OBJ];
+    u32_t neighbours[NUM_FUSED_OBJ][NUM_SLOT_WORDS];
+
+    for (i = GetNextLiveFusedObject(fusedObjectStore, 0u); i < NUM_FUSED_OBJ; i = GetNextLiveFusedObject(fusedObjectStore, i + 1u))
+    {
+        posX[i] = fusedObjectStore->hot[i].X[STATE_X];
+        sorted[numSorted] = i;
+        numSorted++;
+
+        (void)memset(neighbours[i], 0, sizeof(neighbours[i]));
+    }
+
+    SortObjectsByX(sorted, numSorted, posX);
+
+    /* Since the objects are sorted, the distance in x is never negative (same as its absolute value).
+       Each pair inside the window is kept with its lower index, as a bit of its higher index. */
+    for (i = 0u; i < numSorted; i++)
+    {
+        for (j = (i + 1u);
+             (j < numSorted) && ((posX[sorted[j]] - posX[sorted[i]]) <= PRUNE_LIMIT_X);
+             j++)
+        {
+            object1 = (sorted[i] < sorted[j]) ? sorted[i] : sorted[j];
+            object2 = (sorted[i] < sorted[j]) ? sorted[j] : sorted[i];
+
+            SetBitmapBit(neighbours[object1], object2);
+        }
+    }
+
+    /* The pairs are checked in index order (lower, then higher index), same as the loop over all the pairs. */
+    for (i = GetNextLiveFusedObject(fusedObjectStore, 0u); i < NUM_FUSED_OBJ; i = GetNextLiveFusedObject(fusedObjectStore, i + 1u))
+    {
+        for (neighbour = FindNextSetBit(neighbours[i], NUM_SLOT_WORDS, i + 1u);
+             (neighbour < NUM_FUSED_OBJ) && (fusedObjectStore->hot[i].id != INVALID_ID);
+             neighbour = FindNextSetBit(neighbours[i], NUM_SLOT_WORDS, neighbour + 1u))
+        {
+            if (fusedObjectStore->hot[neighbour].id != INVALID_ID)
+            {
+                CheckObjectsForPruning(fusedObjectStore, i, (u8_t)neighbour);
+            }
+        }
+    }
+}
+
+void MaintainObject(FusedObjectStore_t* fusedObjectStore, const u8_t index)
+{
+    u8_t i;
+
+    fusedObjectStore->cold[index].lifetimeCounter = (fusedObjectStore->cold[index].lifetimeCounter + 1) % U16_MAX;
 
     /* Don't update lost counter if it's the first cycle of the object! */
-    if (fusedObject->lifetimeCounter > 1u)
+    if (fusedObjectStore->cold[index].lifetimeCounter > 1u)
     {
-        if (IsObjectLost(fusedObject))
+        if (IsObjectLost(fusedObjectStore, index))
         {
-            fusedObject->lostCounter = (fusedObject->lostCounter + 1) % U8_MAX;
+            fusedObjectStore->hot[index].lostCounter = (fusedObjectStore->hot[index].lostCounter + 1) % U8_MAX;
 
-            if (!IsObjectCoastable(fusedObject))
+            if (!IsObjectCoastable(fusedObjectStore, index))
             {
-                ResetFusedObject(fusedObject);
+                ResetFusedObject(fusedObjectStore, index);
             }
         }
         else
         {
-            fusedObject->lostCounter = 0u;
+            fusedObjectStore->hot[index].lostCounter = 0u;
         }
     }
 
-    (void)memset(fusedObject->seenThisCycle, 0, sizeof(u8_t) * NUM_SENSORS);
+    for (i = 0u; i < numSensors; i++)
+    {
+        fusedObjectStore->hot[index].seenThisCycle[i] = 0u;
+    }
 }
 
-u8_t IsTentativeObjectConfirmed(const FusedObject_t* fusedObject)
+u8_t IsTentativeObjectConfirmed(const FusedObjectStore_t* fusedObjectStore, const u8_t index)
 {
     u8_t confirmed = FALSE;
 
-    if ((fusedObject->id != INVALID_ID) &&
-        (fusedObject->lifetimeCounter >= MIN_LIFETIME_TX_CYCLES))
+    if ((fusedObjectStore->hot[index].id != INVALID_ID) &&
+        (fusedObjectStore->cold[index].lifetimeCounter >= MIN_LIFETIME_TX_CYCLES))
     {
         confirmed = TRUE;
     }
@@ -0,0 +1,206 @@
+/*
+ * Copyright (C) 2016 Dimitris Geromichalos
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+ /**
+  * The gating of a plot against all the tracks at once.
+  * The loops have a fixed trip count and no branches (only selects),
+  * so that the compiler vectorizes them over the tracks.
+  */
+
+/******************************** Inclusions *********************************/
+
+#include <string.h>
+
+#include "constants.h"
+
+#include "gating.h"
+
+/************************ Static Function Prototypes *************************/
+
+/**
+  * @brief Calculates the acceptance interval of the position of a plot in each axis.
+  * @param plot The plot to be gated.
+  * @param weights The gating weight of each state.
+  * @param lower The lower bound of each axis.
+  * @param upper The upper bound of each axis.
+  * @return Void.
+  */
+static void GetPlotInterval(const Plot_t* plot, const real_t* weights, real_t* lower, real_t* upper);
+
+/***************************** Static Functions ******************************/
+
+void GetPlotInterval(const Plot_t* plot, const real_t* weights, real_t* lower, real_t* upper)
+{
+    u8_t i, state;
+    real_t halfWidth;
+
+    for (i = 0u; i < KALMAN_AXES; i++)
+    {
+        state = GET_STATE_FROM_AXIS(i, 0u);
+        halfWidth = GATING_INTERVAL_MARGIN * REAL_SQRT(weights[state] * plot->R[(KALMAN_STATES * state) + state] / STATE_GATING_VALUE_MIN_LIMIT);
+
+        lower[i] = plot->Z[state] - halfWidth;
+        upper[i] = plot->Z[state] + halfWidth;
+    }
+}
+
+/***************************** Public Functions ******************************/
+
+void SetGatingTrack(GatingTracks_t* tracks, const u8_t index, const real_t* X, const real_t* variance, const real_t* weights)
+{
+    u8_t i, state;
+    real_t halfWidth;
+
+    for (i = 0u; i < KALMAN_STATES; i++)
+    {
+        tracks->mean[i][index] = X[i];
+        tracks->variance[i][index] = variance[i];
+    }
+
+    for (i = 0u; i < KALMAN_AXES; i++)
+    {
+        state = GET_STATE_FROM_AXIS(i, 0u);
+        halfWidth = GATING_INTERVAL_MARGIN * REAL_SQRT(weights[state] * tracks->variance[state][index] / STATE_GATING_VALUE_MIN_LIMIT);
+
+        tracks->lower[i][index] = X[state] - halfWidth;
+        tracks->upper[i][index] = X[state] + halfWidth;
+    }
+
+    SetBitmapBit(tracks->changed, index);
+}
+
+void GetGatingValues(const GatingTracks_t* tracks, const Plot_t* plot, const real_t* weights, real_t* gatingValues)
+{
+    u8_t i, j, block;
+    real_t mean, weight, weightedPlotVariance, maxSimilarity;
+    real_t dist, dist2, weightedVariance, outsideBlock;
+    real_t lower[KALMAN_AXES], upper[KALMAN_AXES];
+    real_t similaritySum[NUM_BATCH_TRACKS];
+    real_t outsideStates[NUM_BATCH_TRACKS];
+    const real_t* trackMean;
+    const real_t* trackVariance;
+    real_t* blockSum;
+    real_t* blockOutside;
+
+    /* Summed locally, so that the output can not alias the inputs of the inner loops. */
+    (void)memset(similaritySum, 0, sizeof(similaritySum));
+    (void)memset(outsideStates, 0, sizeof(outsideStates));
+
+    GetPlotInterval(plot, weights, lower, upper);
+
+    /* Pre-gate: the position interval of the plot must overlap the one of the track in all the axes. */
+    for (i = 0u; i < KALMAN_AXES; i++)
+    {
+        for (j = 0u; j < NUM_BATCH_TRACKS; j++)
+        {
+            outsideStates[j] += (upper[i] > tracks->lower[i][j]) ? 0.f : 1.f;
+            outsideStates[j] += (lower[i] < tracks->upper[i][j]) ? 0.f : 1.f;
+        }
+    }
+
+    for (block = 0u; block < NUM_BATCH_TRACKS; block += VECTOR_LANES)
+    {
+        blockSum = &similaritySum[block];
+        blockOutside = &outsideStates[block];
+        outsideBlock = 1.f;
+
+        for (j = 0u; j < VECTOR_LANES; j++)
+        {
+            outsideBlock *= blockOutside[j];
+        }
+
+        /* The similarities are only calculated for the blocks of tracks that have a lane inside the pre-gate. */
+        if (outsideBlock == 0.f)
+        {
+            for (i = 0u; i < KALMAN_STATES; i++)
+            {
+                mean = plot->Z[i];
+                weight = weights[i];
+                weightedPlotVariance = weight * plot->R[(KALMAN_STATES * i) + i];
+                maxSimilarity = weight * MAX_SIMILARITY_VALUE;
+                trackMean = &tracks->mean[i][block];
+                trackVariance = &tracks->variance[i][block];
+
+                for (j = 0u; j < VECTOR_LANES; j++)
+                {
+                    dist = mean - trackMean[j];
+                    dist2 = dist * dist;
+                    weightedVariance = weightedPlotVariance + (weight * trackVariance[j]);
+
+                    /* On zero distance, the max similarity is divided by one instead, so that the reciprocal is never a branch. */
+                    blockSum[j] += ((dist2 > 0.f) ? weightedVariance : maxSimilarity) * (1.f / (dist2 + ((dist2 > 0.f) ? 0.f : 1.f)));
+                    blockOutside[j] += (weightedVariance > (STATE_GATING_VALUE_MIN_LIMIT * dist2)) ? 0.f : 1.f;
+                }
+            }
+        }
+    }
+
+    for (j = 0u; j < NUM_BATCH_TRACKS; j++)
+    {
+        gatingValues[j] = (outsideStates[j] == 0.f) ? similaritySum[j] : INVALID_GATING_VALUE;
+    }
+}
+
+real_t GetGatingValue(const GatingTracks_t* tracks, const u8_t index, const Plot_t* plot, const real_t* weights)
+{
+    u8_t i;
+    real_t weight, dist, dist2, weightedVariance;
+    real_t similaritySum = 0.f, outsideStates = 0.f;
+    real_t lower[KALMAN_AXES], upper[KALMAN_AXES];
+
+    GetPlotInterval(plot, weights, lower, upper);
+
+    for (i = 0u; i < KALMAN_AXES; i++)
+    {
+        outsideStates += (upper[i] > tracks->lower[i][index]) ? 0.f : 1.f;
+        outsideStates += (lower[i] < tracks->upper[i][index]) ? 0.f : 1.f;
+    }
+
+    if (outsideStates == 0.f)
+    {
+        for (i = 0u; i < KALMAN_STATES; i++)
+        {
+            weight = weights[i];
+            dist = plot->Z[i] - tracks->mean[i][index];
+            dist2 = dist * dist;
+            weightedVariance = (weight * plot->R[(KALMAN_STATES * i) + i]) + (weight * tracks->variance[i][index]);
+
+            similaritySum += ((dist2 > 0.f) ? weightedVariance : (weight * MAX_SIMILARITY_VALUE)) * (1.f / (dist2 + ((dist2 > 0.f) ? 0.f : 1.f)));
+            outsideStates += (weightedVariance > (STATE_GATING_VALUE_MIN_LIMIT * dist2)) ? 0.f : 1.f;
+        }
+    }
+
+    return ((outsideStates == 0.f) ? similaritySum : INVALID_GATING_VALUE);
+}
+
+void ClearGatingChanges(GatingTracks_t* tracks)
+{
+    (void)memset(tracks->changed, 0, sizeof(tracks->changed));
+}
+
+void UpdateGatingValues(const GatingTracks_t* tracks, const Plot_t* plot, const real_t* weights, real_t* gatingValues)
+{
+    u8_t j;
+
+    for (j = 0u; j < NUM_BATCH_TRACKS; j++)
+    {
+        if (IsBitmapBitSet(tracks->changed, j))
+        {
+            gatingValues[j] = GetGatingValue(tracks, j, plot, weights);
+        }
+    }
+}
@@ -0,0 +1,231 @@
+/*
+ * Copyright (C) 2016 Dimitris Geromichalos
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+ /**
+  * The gating of the plots of the sensors in parallel.
+  * The plots of the sensors are independent, so that each worker gates the plots of its sensors against the same tracks.
+  * The sensors are dealt to the workers by their index, so that the radars of the vehicle are spread over all the workers.
+  * A worker waits for a new job (a sequence number), gates its share of the plots and reports back.
+  * Each worker is bound to a core of its own (if there is one), away from the core of the process.
+  */
+
+/******************************** Inclusions *********************************/
+
+#define _GNU_SOURCE
+
+#include <stdint.h>
+#include <string.h>
+#include <sched.h>
+#include <unistd.h>
+#include <pthread.h>
+
+#include "gating.h"
+
+#include "gating_workers.h"
+
+/***************************** Static Variables ******************************/
+
+/** The job shared with the workers, valid while its sequence number is current. */
+static const GatingTracks_t* jobTracks;
+static const PrefusedObject_t* jobPrefusedObjectList;
+static u8_t jobNumPrefusedObjects;
+static const u8_t* jobGatePlot;
+static const real_t* jobWeights;
+static real_t (*jobGatingValues)[NUM_BATCH_TRACKS];
+
+/** The number of plots gated by each share of the last job, each written by its own share only. */
+static u8_t shareGatedPlots[GATING_WORKERS + 1u];
+
+#if (GATING_WORKERS > 0u)
+/** The worker threads, started on the first job. */
+static pthread_t workers[GATING_WORKERS];
+static u8_t numWorkers;
+static u8_t workersStarted = FALSE;
+
+/** The sequence number of the current job and the number of workers that finished it, guarded by the mutex. */
+static pthread_mutex_t jobMutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t jobStarted = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t jobFinished = PTHREAD_COND_INITIALIZER;
+static u32_t jobSequence;
+static u8_t jobDoneCount;
+#endif
+
+/************************ Static Function Prototypes *************************/
+
+/**
+  * @brief Gates the plots of the sensors of a share of the current job.
+  * @details The sensors are dealt to the shares in turn by their index, the calling thread having share zero.
+  * @param share The share of the job.
+  * @param numShares The number of shares of the job.
+  * @return Void.
+  */
+static void GateSharePlots(const u8_t share, const u8_t numShares);
+
+#if (GATING_WORKERS > 0u)
+/**
+  * @brief Starts the worker threads.
+  * @details The worker n is bound to the core n (modulo the number of cores), so that the core 0 is left to the process.
+  * @return Void.
+  */
+static void StartGatingWorkers(void);
+
+/**
+  * @brief The main loop of a worker thread.
+  * @param arg The share of the worker (1 to `GATING_WORKERS`).
+  * @return Never returns.
+  */
+static void* RunGatingWorker(void* arg);
+#endif
+
+/***************************** Static Functions ******************************/
+
+void GateSharePlots(const u8_t share, const u8_t numShares)
+{
+    u8_t i;
+    u8_t numGatedPlots = 0u;
+
+    for (i = 0u; i < jobNumPrefusedObjects; i++)
+    {
+        if (jobGatePlot[i] && ((jobPrefusedObjectList[i].sensor->id % numShares) == share))
+        {
+            GetGatingValues(jobTracks, &jobPrefusedObjectList[i].plot, jobWeights, jobGatingValues[i]);
+            numGatedPlots++;
+        }
+    }
+
+    shareGatedPlots[share] = numGatedPlots;
+}
+
+#if (GATING_WORKERS > 0u)
+void StartGatingWorkers(void)
+{
+    u8_t i;
+    long numCores = sysconf(_SC_NPROCESSORS_ONLN);
+    cpu_set_t cores;
+    pthread_attr_t attr;
+
+    numWorkers = 0u;
+
+    for (i = 0u; i < GATING_WORKERS; i++)
+    {
+        (void)pthread_attr_init(&attr);
+        (void)pthread_attr_setinheritsched(&attr, PTHREAD_INHERIT_SCHED);
+
+        if (numCores > 1)
+        {
+            CPU_ZERO(&cores);
+            CPU_SET((i + 1u) % (u32_t)numCores, &cores);
+            (void)pthread_attr_setaffinity_np(&attr, sizeof(cores), &cores);
+        }
+
+        /* The share of a worker is known before it is created, so that a failed worker leaves no gap. */
+        if (pthread_create(&workers[numWorkers], &attr, RunGatingWorker, (void*)(uintptr_t)(numWorkers + 1u)) == 0)
+        {
+            numWorkers++;
+        }
+
+        (void)pthread_attr_destroy(&attr);
+    }
+
+    workersStarted = TRUE;
+}
+
+void* RunGatingWorker(void* arg)
+{
+    u8_t share = (u8_t)(uintptr_t)arg;
+    u32_t sequence = 0u;
+
+    for (;;)
+    {
+        (void)pthread_mutex_lock(&jobMutex);
+
+        while (jobSequence == sequence)
+        {
+            (void)pthread_cond_wait(&jobStarted, &jobMutex);
+        }
+
+        sequence = jobSequence;
+
+        (void)pthread_mutex_unlock(&jobMutex);
+
+        GateSharePlots(share, numWorkers + 1u);
+
+        (void)pthread_mutex_lock(&jobMutex);
+
+        jobDoneCount++;
+
+        if (jobDoneCount == numWorkers)
+        {
+            (void)pthread_cond_signal(&jobFinished);
+        }
+
+        (void)pthread_mutex_unlock(&jobMutex);
+    }
+
+    return (void*)NULL;
+}
+#endif
+
+/***************************** Public Functions ******************************/
+
+void GetPlotGatingValues(const GatingTracks_t* tracks, const PrefusedObject_t* prefusedObjectList, const u8_t numPrefusedObjects, const u8_t* gatePlot,
+                         const real_t* weights, real_t (*gatingValues)[NUM_BATCH_TRACKS])
+{
+    jobTracks = tracks;
+    jobPrefusedObjectList = prefusedObjectList;
+    jobNumPrefusedObjects = numPrefusedObjects;
+    jobGatePlot = gatePlot;
+    jobWeights = weights;
+    jobGatingValues = gatingValues;
+
+#if (GATING_WORKERS > 0u)
+    if (!workersStarted)
+    {
+        StartGatingWorkers();
+    }
+
+    /* A share left without a worker gates nothing. */
+    (void)memset(shareGatedPlots, 0, sizeof(shareGatedPlots));
+
+    /* The job is published by the mutex, before any worker can see the new sequence number. */
+    (void)pthread_mutex_lock(&jobMutex);
+
+    jobDoneCount = 0u;
+    jobSequence++;
+
+    (void)pthread_cond_broadcast(&jobStarted);
+    (void)pthread_mutex_unlock(&jobMutex);
+
+    GateSharePlots(0u, numWorkers + 1u);
+
+    (void)pthread_mutex_lock(&jobMutex);
+
+    while (jobDoneCount < numWorkers)
+    {
+        (void)pthread_cond_wait(&jobFinished, &jobMutex);
+    }
+
+    (void)pthread_mutex_unlock(&jobMutex);
+#else
+    GateSharePlots(0u, 1u);
+#endif
+}
+
+u8_t GetShareGatedPlots(const u8_t share)
+{
+    return (share <= GATING_WORKERS) ? shareGatedPlots[share] : 0u;
+}
@@ -0,0 +1,65 @@
+/*
+ * Copyright (C) 2016 Dimitris Geromichalos
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+ /**
+  * An allocator of the IDs of the fused objects, based on a bitmap of the used IDs.
+  * The lowest available ID is always allocated, same as searching the fused object list for it.
+  */
+
+/******************************** Inclusions *********************************/
+
+#include <string.h>
+
+#include "id_allocator.h"
+
+/***************************** Public Functions ******************************/
+
+void ResetIdAllocator(IdAllocator_t* allocator, const ObjectId_t maxId)
+{
+    u32_t id;
+
+    (void)memset(allocator->used, 0, sizeof(allocator->used));
+
+    SetBitmapBit(allocator->used, INVALID_ID);
+
+    for (id = maxId; id < (NUM_ID_WORDS * BITMAP_WORD_BITS); id++)
+    {
+        SetBitmapBit(allocator->used, id);
+    }
+}
+
+ObjectId_t AllocateId(IdAllocator_t* allocator)
+{
+    ObjectId_t id = INVALID_ID;
+    u32_t bit = FindFirstZeroBit(allocator->used, NUM_ID_WORDS);
+
+    if (bit < MAX_ID)
+    {
+        SetBitmapBit(allocator->used, bit);
+        id = (ObjectId_t)bit;
+    }
+
+    return id;
+}
+
+void FreeId(IdAllocator_t* allocator, const ObjectId_t id)
+{
+    if ((id != INVALID_ID) && (id < MAX_ID))
+    {
+        ClearBitmapBit(allocator->used, id);
+    }
+}
@@ -0,0 +1,258 @@
+/*
+ * Copyright (C) 2016 Dimitris Geromichalos
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+ /**
+  * A solver for the joint probabilistic data association (JPDA), used by the JPDA association mode.
+  * The hypotheses are enumerated depth-first (without recursion), one row per level, so that
+  * the hypotheses that pair two rows with the same column are never visited.
+  */
+
+/******************************** Inclusions *********************************/
+
+#include <string.h>
+
+#include "constants.h"
+
+#include "jpda.h"
+
+/************************ Static Function Prototypes *************************/
+
+/**
+  * @brief Finds the root of the cluster of a node, halving the path to it.
+  * @param parent The parent of each node.
+  * @param node The node (row, or `MAX_ASSIGNMENT_ROWS` + column).
+  * @return The root node.
+  */
+static u8_t FindClusterRoot(u8_t* parent, u8_t node);
+
+/**
+  * @brief Enumerates the hypotheses of a cluster and accumulates the weights of the options of its rows.
+  * @param workspace The workspace, with the rows of the cluster and their options and likelihoods set.
+  * @param numRows The number of rows of the cluster.
+  * @param maxHypotheses The max number of hypotheses of the cluster.
+  * @return The number of hypotheses, or more than the max if the enumeration was abandoned.
+  */
+static u32_t EnumerateHypotheses(JpdaWorkspace_t* workspace, const u8_t numRows, const u32_t maxHypotheses);
+
+/***************************** Static Functions ******************************/
+
+u8_t FindClusterRoot(u8_t* parent, u8_t node)
+{
+    while (parent[node] != node)
+    {
+        parent[node] = parent[parent[node]];
+        node = parent[node];
+    }
+
+    return node;
+}
+
+u32_t EnumerateHypotheses(JpdaWorkspace_t* workspace, const u8_t numRows, const u32_t maxHypotheses)
+{
+    u8_t i, level = 0u, row, option;
+    u8_t done = FALSE;
+    u32_t numHypotheses = 0u;
+
+    (void)memset(workspace->used, 0, sizeof(workspace->used));
+
+    workspace->weight[0] = 1.;
+    workspace->choice[0] = 0u;
+
+    while (!done)
+    {
+        row = workspace->clusterRows[level];
+        option = workspace->choice[level];
+
+        /* Skip the columns taken by the rows above (the last option, not paired, is always free). */
+        while ((option < workspace->numOptions[row]) && workspace->used[workspace->options[row][option]])
+        {
+            option++;
+        }
+
+        workspace->choice[level] = option;
+
+        if (option > workspace->numOptions[row])
+        {
+            /* All the options of the level are exhausted, so the next option of the level above is taken. */
+            if (level == 0u)
+            {
+                done = TRUE;
+            }
+            else
+            {
+                level--;
+                row = workspace->clusterRows[level];
+
+                if (workspace->choice[level] < workspace->numOptions[row])
+                {
+                    workspace->used[workspace->options[row][workspace->choice[level]]] = FALSE;
+                }
+
+                workspace->choice[level]++;
+            }
+        }
+        else
+        {
+            workspace->weight[level + 1u] = workspace->weight[level] * workspace->likelihood[row][option];
+
+            if ((level + 1u) < numRows)
+            {
+                if (option < workspace->numOptions[row])
+                {
+                    workspace->used[workspace->options[row][option]] = TRUE;
+                }
+
+                level++;
+                workspace->choice[level] = 0u;
+            }
+            else
+            {
+                numHypotheses++;
+
+                if (numHypotheses > maxHypotheses)
+                {
+                    done = TRUE;
+                }
+                else
+                {
+                    for (i = 0u; i < numRows; i++)
+                    {
+                        workspace->optionWeight[workspace->clusterRows[i]][workspace->choice[i]] += workspace->weight[numRows];
+                    }
+
+                    workspace->choice[level]++;
+                }
+            }
+        }
+    }
+
+    return numHypotheses;
+}
+
+/***************************** Public Functions ******************************/
+
+void SolveJpda(JpdaWorkspace_t* workspace, const real_t (*cost)[MAX_ASSIGNMENT_COLS], const u8_t rows,
+               const real_t noneLikelihood, const u32_t maxHypotheses, AssociationStats_t* stats)
+{
+    u8_t i, j, k, root, numRows;
+    u32_t numHypotheses;
+    f64_t maxLikelihood, totalWeight;
+
+    (void)memset(workspace->marginal, 0, sizeof(workspace->marginal));
+    (void)memset(workspace->fallback, 0, sizeof(workspace->fallback));
+    (void)memset(workspace->optionWeight, 0, sizeof(workspace->optionWeight));
+
+    for (i = 0u; i < NUM_JPDA_NODES; i++)
+    {
+        workspace->parent[i] = i;
+    }
+
+    /* The options of each row, with the likelihoods scaled by the max of the row, so that the products do not overflow.
+     * Every hypothesis holds one option per row, so the scaling does not change the marginals. */
+    for (i = 0u; i < rows; i++)
+    {
+        workspace->numOptions[i] = 0u;
+        maxLikelihood = noneLikelihood;
+
+        for (j = 0u; j < NUM_FUSED_OBJ; j++)
+        {
+            if (cost[i][j] < DUMMY_ASSIGNMENT_COST)
+            {
+                k = workspace->numOptions[i];
+
+                workspace->options[i][k] = j;
+                workspace->likelihood[i][k] = -cost[i][j];
+                workspace->numOptions[i]++;
+
+                maxLikelihood = (workspace->likelihood[i][k] > maxLikelihood) ? workspace->likelihood[i][k] : maxLikelihood;
+
+                workspace->parent[FindClusterRoot(workspace->parent, MAX_ASSIGNMENT_ROWS + j)] = FindClusterRoot(workspace->parent, i);
+            }
+        }
+
+        workspace->likelihood[i][workspace->numOptions[i]] = noneLikelihood;
+
+        for (k = 0u; k <= workspace->numOptions[i]; k++)
+        {
+            workspace->likelihood[i][k] /= maxLikelihood;
+        }
+    }
+
+    /* Each cluster is solved once, from its first row. */
+    for (i = 0u; i < rows; i++)
+    {
+        root = FindClusterRoot(workspace->parent, i);
+
+        /* A solved cluster has its first row as its root, which comes before the rest of its rows. */
+        if (root < i)
+        {
+            continue;
+        }
+
+        /* Else, this is the first row of the cluster, which is made its root so that the rest of its rows find it. */
+        workspace->parent[root] = i;
+        workspace->parent[i] = i;
+
+        numRows = 0u;
+
+        for (j = i; j < rows; j++)
+        {
+            if (FindClusterRoot(workspace->parent, j) == i)
+            {
+                workspace->clusterRows[numRows] = j;
+                numRows++;
+            }
+        }
+
+        numHypotheses = EnumerateHypotheses(workspace, numRows, maxHypotheses);
+
+        stats->clusters++;
+
+        if (numHypotheses > maxHypotheses)
+        {
+            stats->hypotheses += maxHypotheses;
+            stats->fallbacks++;
+
+            for (j = 0u; j < numRows; j++)
+            {
+                workspace->fallback[workspace->clusterRows[j]] = TRUE;
+            }
+        }
+        else
+        {
+            stats->hypotheses += numHypotheses;
+
+            for (j = 0u; j < numRows; j++)
+            {
+                root = workspace->clusterRows[j];
+                totalWeight = 0.;
+
+                for (k = 0u; k <= workspace->numOptions[root]; k++)
+                {
+                    totalWeight += workspace->optionWeight[root][k];
+                }
+
+                for (k = 0u; k < workspace->numOptions[root]; k++)
+                {
+                    workspace->marginal[root][workspace->options[root][k]] = (real_t)(workspace->optionWeight[root][k] / totalWeight);
+                }
+
+                workspace->marginal[root][JPDA_NONE_COL] = (real_t)(workspace->optionWeight[root][workspace->numOptions[root]] / totalWeight);
+            }
+        }
+    }
+}
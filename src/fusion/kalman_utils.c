@@ -25,17 +25,7 @@
 #include "algorithm_types.h"
 
 #include "kalman_utils.h"
-
-/***************************** Static Variables ******************************/
-
-/** The state prediction matrix of the process. */
-static KalmanF_t F;
-
-/** The upper decomposed matrix of Q. */
-static KalmanQu_t Qu;
-
-/** The diagonal decomposed matrix of Q. */
-static KalmanQd_t Qd;
+#include "kalman_kernels.h"
 
 /************************ Static Function Prototypes *************************/
 
@@ -45,7 +35,7 @@ static KalmanQd_t Qd;
   * @param square The square matrix.
   * @return Void.
   */
-void ConvertDiagonalVectorToMatrix(const f32_t* diagonal, f32_t* square);
+void ConvertDiagonalVectorToMatrix(const real_t* diagonal, real_t* square);
 
 /**
   * @brief Transforms an upper triangular matrix to a full matrix.
@@ -53,7 +43,7 @@ void ConvertDiagonalVectorToMatrix(const f32_t* diagonal, f32_t* square);
   * @param square The square matrix.
   * @return Void.
   */
-void ConvertUpperMatrixToFull(const f32_t* upper, f32_t* square);
+void ConvertUpperMatrixToFull(const real_t* upper, real_t* square);
 
 /**
   * @brief Multiplies two matrices.
@@ -61,7 +51,7 @@ void ConvertUpperMatrixToFull(const f32_t* upper, f32_t* square);
   * @param B The second matrix.
   * @return Void.
   */
-void MultiplyMatrix(const f32_t* A, const f32_t* B, f32_t* C);
+void MultiplyMatrix(const real_t* A, const real_t* B, real_t* C);
 
 /**
   * @brief Transposes a matrix.
@@ -69,15 +59,22 @@ void MultiplyMatrix(const f32_t* A, const f32_t* B, f32_t* C);
   * @param At The transposed matrix.
   * @return Void.
   */
-void TransposeMatrix(const f32_t* A, f32_t* At);
+void TransposeMatrix(const real_t* A, real_t* At);
 
 /***************************** Static Functions ******************************/
 
-void ConvertDiagonalVectorToMatrix(const f32_t* diagonal, f32_t* square)
+#ifndef KALMAN_GENERIC_KERNELS
+/** The specialized kernels must match the dimension of the LKF. */
+typedef u8_t KalmanKernelDimension_t[(KALMAN_STATES == 4) ? 1 : -1];
+
+DEFINE_KALMAN_KERNELS(4)
+#endif
+
+void ConvertDiagonalVectorToMatrix(const real_t* diagonal, real_t* square)
 {
     s16_t i;
 
-    (void)memset(square, 0u, sizeof(f32_t) * KALMAN_STATES * KALMAN_STATES);
+    (void)memset(square, 0u, sizeof(real_t) * KALMAN_STATES * KALMAN_STATES);
 
     for (i = 0u; i < KALMAN_STATES; i++)
     {
@@ -85,11 +82,11 @@ void ConvertDiagonalVectorToMatrix(const f32_t* diagonal, f32_t* square)
     }
 }
 
-void ConvertUpperMatrixToFull(const f32_t* upper, f32_t* square)
+void ConvertUpperMatrixToFull(const real_t* upper, real_t* square)
 {
     s16_t i, j;
 
-    (void)memset(square, 0u, sizeof(f32_t) * KALMAN_STATES * KALMAN_STATES);
+    (void)memset(square, 0u, sizeof(real_t) * KALMAN_STATES * KALMAN_STATES);
 
     for (i = 0u; i < KALMAN_STATES; i++)
     {
@@ -103,7 +100,7 @@ void ConvertUpperMatrixToFull(const f32_t* upper, f32_t* square)
     }
 }
 
-void MultiplyMatrix(const f32_t* A, const f32_t* B, f32_t* C)
+void MultiplyMatrix(const real_t* A, const real_t* B, real_t* C)
 {
     s16_t i, j, k;
     
@@ -121,7 +118,7 @@ void MultiplyMatrix(const f32_t* A, const f32_t* B, f32_t* C)
     }
 }
 
-void TransposeMatrix(const f32_t* A, f32_t* At)
+void TransposeMatrix(const real_t* A, real_t* At)
 {
     s16_t i, j;
     
@@ -136,30 +133,53 @@ void TransposeMatrix(const f32_t* A, f32_t* At)
 
 /***************************** Public Functions ******************************/
 
-void ComposeUD(const f32_t* U, const f32_t* D, f32_t* UDU)
+void ComposeUD(const real_t* U, const real_t* D, real_t* UDU)
 {
-    f32_t tempMatrix1[KALMAN_STATES * KALMAN_STATES];
-    f32_t tempMatrix2[KALMAN_STATES * KALMAN_STATES];
-    f32_t tempMatrix3[KALMAN_STATES * KALMAN_STATES];
+#ifdef KALMAN_GENERIC_KERNELS
+    real_t tempMatrix1[KALMAN_STATES * KALMAN_STATES];
+    real_t tempMatrix2[KALMAN_STATES * KALMAN_STATES];
+    real_t tempMatrix3[KALMAN_STATES * KALMAN_STATES];
 
     (void)ConvertDiagonalVectorToMatrix(D, tempMatrix1);
     (void)ConvertUpperMatrixToFull(U, tempMatrix2);
-    (void)TransposeMatrix((const f32_t*) tempMatrix2, UDU);
-    (void)MultiplyMatrix((const f32_t*) tempMatrix1, (const f32_t*) UDU, tempMatrix3);
-    (void)MultiplyMatrix((const f32_t*) tempMatrix2, (const f32_t*) tempMatrix3, UDU);
+    (void)TransposeMatrix((const real_t*) tempMatrix2, UDU);
+    (void)MultiplyMatrix((const real_t*) tempMatrix1, (const real_t*) UDU, tempMatrix3);
+    (void)MultiplyMatrix((const real_t*) tempMatrix2, (const real_t*) tempMatrix3, UDU);
+#else
+    (void)ComposeUD4(U, D, UDU);
+#endif
+}
+
+void ComposeDiagonalUD(const real_t* U, const real_t* D, real_t* V)
+{
+    s16_t i, k;
+    real_t sigma;
+
+    for (i = 0u; i < KALMAN_STATES; i++)
+    {
+        sigma = 0.f;
+
+        for (k = i; k < KALMAN_STATES; k++)
+        {
+            sigma += U[GET_UPPER_INDEX(i, k, KALMAN_STATES)] * (D[k] * U[GET_UPPER_INDEX(i, k, KALMAN_STATES)]);
+        }
+
+        V[i] = sigma;
+    }
 }
 
-void DecomposeUD(const f32_t* UDU, f32_t* U, f32_t* D)
+void DecomposeUD(const real_t* UDU, real_t* U, real_t* D)
 {
+#ifdef KALMAN_GENERIC_KERNELS
     s16_t i, j, k;
-    f32_t sigma;
+    real_t sigma;
 
     (void)memset(U, 0, GET_BYTE_UPPER(KALMAN_STATES));
-    (void)memset(D, 0, sizeof(f32_t) * KALMAN_STATES);
+    (void)memset(D, 0, sizeof(real_t) * KALMAN_STATES);
 
-    for (j = KALMAN_STATES - 1u; j >= 0u; j--)
+    for (j = KALMAN_STATES - 1u; j >= 0; j--)
     {
-        for (i = j; i >= 0u; i--)
+        for (i = j; i >= 0; i--)
         {
             sigma = UDU[(KALMAN_STATES * i) + j];
             
@@ -179,14 +199,17 @@ void DecomposeUD(const f32_t* UDU, f32_t* U, f32_t* D)
             }
         }
     }
+#else
+    (void)DecomposeUD4(UDU, U, D);
+#endif
 }
 
-void PredictState(const f32_t* inputF, f32_t* state)
+void PredictState(const real_t* inputF, real_t* state)
 {
     s16_t i, j;
-    f32_t tempVector[KALMAN_STATES];
+    real_t tempVector[KALMAN_STATES];
 
-    (void)memset(tempVector, 0u, sizeof(f32_t) * KALMAN_STATES);
+    (void)memset(tempVector, 0u, sizeof(real_t) * KALMAN_STATES);
 
     for (i = 0u; i < KALMAN_STATES; i++)
     {
@@ -196,19 +219,20 @@ void PredictState(const f32_t* inputF, f32_t* state)
         }
     }
 
-    (void)memcpy(state, tempVector, sizeof(f32_t) * KALMAN_STATES);
+    (void)memcpy(state, tempVector, sizeof(real_t) * KALMAN_STATES);
 }
 
-void FuseState(const f32_t innovation, const f32_t alpha, const f32_t* transformation, f32_t* state, f32_t* outputQu, f32_t* outputQd)
+void FuseState(const real_t innovation, const real_t alpha, const real_t* transformation, real_t* state, real_t* outputQu, real_t* outputQd)
 {
+#ifdef KALMAN_GENERIC_KERNELS
     s16_t i, j;
-    f32_t beta, lambda, gamma, scaledInnovation;
-    f32_t tempAlpha = alpha;
-    f32_t tempVector1[KALMAN_STATES];
-    f32_t tempVector2[KALMAN_STATES];
+    real_t beta, lambda, gamma, scaledInnovation;
+    real_t tempAlpha = alpha;
+    real_t tempVector1[KALMAN_STATES];
+    real_t tempVector2[KALMAN_STATES];
     
-    (void)memset(tempVector1, 0u, sizeof(f32_t) * KALMAN_STATES);
-    (void)memset(tempVector2, 0u, sizeof(f32_t) * KALMAN_STATES);
+    (void)memset(tempVector1, 0u, sizeof(real_t) * KALMAN_STATES);
+    (void)memset(tempVector2, 0u, sizeof(real_t) * KALMAN_STATES);
 
     gamma = 1.f / tempAlpha;
     
@@ -216,7 +240,7 @@ void FuseState(const f32_t innovation, const f32_t alpha, const f32_t* transform
     {
         tempVector1[j] = transformation[j];
     
-        for (i = 0u; i <= j - 1u; i++)
+        for (i = 0u; i < j; i++)
         {
             tempVector1[j] += outputQu[GET_UPPER_INDEX(i, j, KALMAN_STATES)] * (transformation[i]);
         }
@@ -235,7 +259,7 @@ void FuseState(const f32_t innovation, const f32_t alpha, const f32_t* transform
         gamma = 1.0f / tempAlpha;
         outputQd[j] *= beta * gamma;
 
-        for (i = 0u; i <= j - 1u; i++)
+        for (i = 0u; i < j; i++)
         {
             beta = outputQu[GET_UPPER_INDEX(i, j, KALMAN_STATES)];
             outputQu[GET_UPPER_INDEX(i, j, KALMAN_STATES)] = beta + (tempVector2[i] * lambda);
@@ -249,23 +273,52 @@ void FuseState(const f32_t innovation, const f32_t alpha, const f32_t* transform
     {
         state[j] += scaledInnovation * tempVector2[j];
     }
+#else
+    (void)FuseState4(innovation, alpha, transformation, state, outputQu, outputQd);
+#endif
 }
 
-void EstimateCovariance(const f32_t* inputF, const f32_t* inputQu, const f32_t* inputQd, f32_t* outputQu, f32_t* outputQd)
+void FuseUnitStates(const real_t* measurement, const real_t* noise, const real_t weight, real_t* state, real_t* outputQu, real_t* outputQd)
 {
+#ifdef KALMAN_GENERIC_KERNELS
+    s16_t i;
+    real_t innovation;
+    KalmanH_t H;
+
+    for (i = 0u; i < KALMAN_STATES; i++)
+    {
+        (void)memset(H, 0, sizeof(KalmanH_t));
+        H[i] = 1.f;
+
+        innovation = measurement[i] - state[i];
+        innovation *= weight;
+
+        (void)FuseState(innovation, noise[i], (const real_t*) H, state, outputQu, outputQd);
+    }
+#else
+    (void)FuseUnitStates4(measurement, noise, weight, state, outputQu, outputQd);
+#endif
+}
+
+void EstimateCovariance(const real_t* inputF, const real_t* inputQu, const real_t* inputQd, real_t* outputQu, real_t* outputQd, KalmanWorkspace_t* workspace)
+{
+#ifdef KALMAN_GENERIC_KERNELS
     s16_t i, j, k;
-    f32_t sigma;
+    real_t sigma;
+    real_t* F = workspace->F;
+    real_t* Qu = workspace->Qu;
+    real_t* Qd = workspace->Qd;
 
-    (void)memset(Qd, 0u, sizeof(f32_t) * KALMAN_STATES);
+    (void)memset(Qd, 0u, sizeof(real_t) * KALMAN_STATES);
     (void)memcpy(Qu, inputQu, GET_BYTE_UPPER(KALMAN_STATES));
 
     for (i = 0u; i < KALMAN_STATES; i++)
     {
-        for (j = KALMAN_STATES - 1u; j >= 0u; j--)
+        for (j = KALMAN_STATES - 1u; j >= 0; j--)
         {
             sigma = inputF[(KALMAN_STATES * i) + j];
         
-            for (k = 0u; k <= j - 1u; k++)
+            for (k = 0u; k < j; k++)
             {
                 sigma += inputF[(KALMAN_STATES * i) + k] * outputQu[GET_UPPER_INDEX(k, j, KALMAN_STATES)];
             }
@@ -274,7 +327,7 @@ void EstimateCovariance(const f32_t* inputF, const f32_t* inputQu, const f32_t*
         }
     }
 
-    for (i = KALMAN_STATES - 1u; i >= 0u; i--)
+    for (i = KALMAN_STATES - 1u; i >= 0; i--)
     {
         sigma = 0.f;
     
@@ -290,7 +343,7 @@ void EstimateCovariance(const f32_t* inputF, const f32_t* inputQu, const f32_t*
 
         Qd[i] = sigma;
         
-        for (j = 0u; j <= i - 1u; j++)
+        for (j = 0u; j < i; j++)
         {
             sigma = 0.0f;
         
@@ -318,5 +371,166 @@ void EstimateCovariance(const f32_t* inputF, const f32_t* inputQu, const f32_t*
         }
     }
 
-    (void)memcpy(outputQd, Qd, sizeof(f32_t) * KALMAN_STATES);
+    (void)memcpy(outputQd, Qd, sizeof(real_t) * KALMAN_STATES);
+#else
+    (void)EstimateCovariance4(inputF, inputQu, inputQd, outputQu, outputQd, workspace->F, workspace->Qu, workspace->Qd);
+#endif
+}
+
+void PredictAxis(const real_t dt, const real_t* inputQ, real_t* pos, real_t* vel, real_t* P)
+{
+    real_t covPosVel = P[GET_UPPER_INDEX(0u, 1u, AXIS_STATES)];
+    real_t varVel = P[GET_UPPER_INDEX(1u, 1u, AXIS_STATES)];
+
+    P[GET_UPPER_INDEX(0u, 0u, AXIS_STATES)] += (dt * ((2.f * covPosVel) + (dt * varVel))) + inputQ[GET_UPPER_INDEX(0u, 0u, AXIS_STATES)];
+    P[GET_UPPER_INDEX(0u, 1u, AXIS_STATES)] += (dt * varVel) + inputQ[GET_UPPER_INDEX(0u, 1u, AXIS_STATES)];
+    P[GET_UPPER_INDEX(1u, 1u, AXIS_STATES)] += inputQ[GET_UPPER_INDEX(1u, 1u, AXIS_STATES)];
+
+    *pos += dt * (*vel);
+}
+
+void FuseAxis(const real_t innovation, const real_t alpha, const u8_t state, real_t* pos, real_t* vel, real_t* P)
+{
+    u8_t other = 1u - state;
+    real_t varState = P[GET_UPPER_INDEX(state, state, AXIS_STATES)];
+    real_t covPosVel = P[GET_UPPER_INDEX(0u, 1u, AXIS_STATES)];
+    real_t gamma = 1.f / (varState + alpha);
+    real_t gainState = varState * gamma;
+    real_t gainOther = covPosVel * gamma;
+    real_t* measured = (state == 0u) ? pos : vel;
+    real_t* unmeasured = (state == 0u) ? vel : pos;
+
+    *measured += gainState * innovation;
+    *unmeasured += gainOther * innovation;
+
+    P[GET_UPPER_INDEX(other, other, AXIS_STATES)] -= gainOther * covPosVel;
+    P[GET_UPPER_INDEX(0u, 1u, AXIS_STATES)] = covPosVel * alpha * gamma;
+    P[GET_UPPER_INDEX(state, state, AXIS_STATES)] = varState * alpha * gamma;
+}
+
+#ifdef VECTOR_EXTENSIONS
+
+void ComposeDiagonalUDLanes(const vreal_t* U, const vreal_t* D, vreal_t* V)
+{
+    s16_t i, k;
+    vreal_t sigma;
+
+    for (i = 0u; i < KALMAN_STATES; i++)
+    {
+        sigma = BroadcastLanes(0.f);
+
+        for (k = i; k < KALMAN_STATES; k++)
+        {
+            sigma += U[GET_UPPER_INDEX(i, k, KALMAN_STATES)] * (D[k] * U[GET_UPPER_INDEX(i, k, KALMAN_STATES)]);
+        }
+
+        V[i] = sigma;
+    }
 }
+
+void PredictStateLanes(const real_t* inputF, vreal_t* state)
+{
+    s16_t i, j;
+    vreal_t tempVector[KALMAN_STATES];
+
+    for (i = 0u; i < KALMAN_STATES; i++)
+    {
+        tempVector[i] = BroadcastLanes(0.f);
+
+        for (j = 0u; j < KALMAN_STATES; j++)
+        {
+            tempVector[i] += inputF[(KALMAN_STATES * i) + j] * state[j];
+        }
+    }
+
+    (void)memcpy(state, tempVector, sizeof(vreal_t) * KALMAN_STATES);
+}
+
+void EstimateCovarianceLanes(const real_t* inputF, const real_t* inputQu, const real_t* inputQd, vreal_t* outputQu, vreal_t* outputQd)
+{
+    s16_t i, j, k;
+    vreal_t sigma;
+    vreal_t tempF[KALMAN_STATES * KALMAN_STATES];
+    vreal_t tempQu[GET_SIZE_UPPER(KALMAN_STATES)];
+    vreal_t tempQd[KALMAN_STATES];
+
+    for (i = 0u; i < GET_SIZE_UPPER(KALMAN_STATES); i++)
+    {
+        tempQu[i] = BroadcastLanes(inputQu[i]);
+    }
+
+    for (i = 0u; i < KALMAN_STATES; i++)
+    {
+        for (j = KALMAN_STATES - 1u; j >= 0; j--)
+        {
+            sigma = BroadcastLanes(inputF[(KALMAN_STATES * i) + j]);
+
+            for (k = 0u; k < j; k++)
+            {
+                sigma += inputF[(KALMAN_STATES * i) + k] * outputQu[GET_UPPER_INDEX(k, j, KALMAN_STATES)];
+            }
+
+            tempF[(KALMAN_STATES * i) + j] = sigma;
+        }
+    }
+
+    for (i = KALMAN_STATES - 1u; i >= 0; i--)
+    {
+        sigma = BroadcastLanes(0.f);
+
+        for (j = 0u; j < KALMAN_STATES; j++)
+        {
+            sigma += tempF[(KALMAN_STATES * i) + j] * tempF[(KALMAN_STATES * i) + j] * outputQd[j];
+
+            if (i <= j)
+            {
+                sigma += tempQu[GET_UPPER_INDEX(i, j, KALMAN_STATES)] * tempQu[GET_UPPER_INDEX(i, j, KALMAN_STATES)] * inputQd[j];
+            }
+        }
+
+        tempQd[i] = sigma;
+
+        for (j = 0u; j < i; j++)
+        {
+            sigma = BroadcastLanes(0.f);
+
+            for (k = 0u; k < KALMAN_STATES; k++)
+            {
+                sigma += tempF[(KALMAN_STATES * i) + k] * outputQd[k] * tempF[(KALMAN_STATES * j) + k];
+
+                if ((i <= k) && (j <= k))
+                {
+                    sigma += tempQu[GET_UPPER_INDEX(i, k, KALMAN_STATES)] * inputQd[k] * tempQu[GET_UPPER_INDEX(j, k, KALMAN_STATES)];
+                }
+            }
+
+            outputQu[GET_UPPER_INDEX(j, i, KALMAN_STATES)] = sigma / tempQd[i];
+
+            for (k = 0u; k < KALMAN_STATES; k++)
+            {
+                tempF[(KALMAN_STATES * j) + k] += -outputQu[GET_UPPER_INDEX(j, i, KALMAN_STATES)] * tempF[(KALMAN_STATES * i) + k];
+
+                if ((i <= k) && (j <= k))
+                {
+                    tempQu[GET_UPPER_INDEX(j, k, KALMAN_STATES)] += -outputQu[GET_UPPER_INDEX(j, i, KALMAN_STATES)] * tempQu[GET_UPPER_INDEX(i, k, KALMAN_STATES)];
+                }
+            }
+        }
+    }
+
+    (void)memcpy(outputQd, tempQd, sizeof(vreal_t) * KALMAN_STATES);
+}
+
+void PredictAxisLanes(const real_t dt, const real_t* inputQ, vreal_t* pos, vreal_t* vel, vreal_t* P)
+{
+    vreal_t covPosVel = P[GET_UPPER_INDEX(0u, 1u, AXIS_STATES)];
+    vreal_t varVel = P[GET_UPPER_INDEX(1u, 1u, AXIS_STATES)];
+
+    P[GET_UPPER_INDEX(0u, 0u, AXIS_STATES)] += (dt * ((2.f * covPosVel) + (dt * varVel))) + inputQ[GET_UPPER_INDEX(0u, 0u, AXIS_STATES)];
+    P[GET_UPPER_INDEX(0u, 1u, AXIS_STATES)] += (dt * varVel) + inputQ[GET_UPPER_INDEX(0u, 1u, AXIS_STATES)];
+    P[GET_UPPER_INDEX(1u, 1u, AXIS_STATES)] += inputQ[GET_UPPER_INDEX(1u, 1u, AXIS_STATES)];
+
+    *pos += dt * (*vel);
+}
+
+#endif
@@ -0,0 +1,227 @@
+/*
+ * Copyright (C) 2016 Dimitris Geromichalos
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+ /**
+  * A binary min-heap of the fused objects by priority, indexed by the fused object list.
+  * The position of each object in the heap is kept, so that any object can be removed in O(log N).
+  */
+
+/******************************** Inclusions *********************************/
+
+#include <string.h>
+
+#include "constants.h"
+
+#include "fused_object_store.h"
+#include "priority_heap.h"
+
+/************************ Static Function Prototypes *************************/
+
+/**
+  * @brief Checks if an object comes before another in the heap.
+  * @details The lower priority comes first and, on equal priorities, the lower index,
+  *          same as the first object found by a scan of the list.
+  * @param fusedObjectStore The store of the fused objects (output of algo).
+  * @param index1 The index of the first object.
+  * @param index2 The index of the second object.
+  * @return Whether the first object comes before the second.
+  */
+static u8_t IsHeapBefore(const FusedObjectStore_t* fusedObjectStore, const u8_t index1, const u8_t index2);
+
+/**
+  * @brief Swaps two positions of the heap.
+  * @param heap The heap.
+  * @param position1 The first position.
+  * @param position2 The second position.
+  * @return Void.
+  */
+static void SwapHeapPositions(PriorityHeap_t* heap, const u8_t position1, const u8_t position2);
+
+/**
+  * @brief Moves the object of a position up, until its parent comes before it.
+  * @param heap The heap.
+  * @param fusedObjectStore The store of the fused objects (output of algo).
+  * @param position The position of the object.
+  * @return Void.
+  */
+static void SiftHeapUp(PriorityHeap_t* heap, const FusedObjectStore_t* fusedObjectStore, u8_t position);
+
+/**
+  * @brief Moves the object of a position down, until it comes before its children.
+  * @param heap The heap.
+  * @param fusedObjectStore The store of the fused objects (output of algo).
+  * @param position The position of the object.
+  * @return Void.
+  */
+static void SiftHeapDown(PriorityHeap_t* heap, const FusedObjectStore_t* fusedObjectStore, u8_t position);
+
+/***************************** Static Functions ******************************/
+
+u8_t IsHeapBefore(const FusedObjectStore_t* fusedObjectStore, const u8_t index1, const u8_t index2)
+{
+    return ((fusedObjectStore->hot[index1].priority < fusedObjectStore->hot[index2].priority) ||
+            ((fusedObjectStore->hot[index1].priority == fusedObjectStore->hot[index2].priority) && (index1 < index2)));
+}
+
+void SwapHeapPositions(PriorityHeap_t* heap, const u8_t position1, const u8_t position2)
+{
+    u8_t index = heap->heap[position1];
+
+    heap->heap[position1] = heap->heap[position2];
+    heap->heap[position2] = index;
+
+    heap->position[heap->heap[position1]] = position1;
+    heap->position[heap->heap[position2]] = position2;
+}
+
+void SiftHeapUp(PriorityHeap_t* heap, const FusedObjectStore_t* fusedObjectStore, u8_t position)
+{
+    u8_t parent;
+
+    while (position > 0u)
+    {
+        parent = (position - 1u) / 2u;
+
+        if (!IsHeapBefore(fusedObjectStore, heap->heap[position], heap->heap[parent]))
+        {
+            break;
+        }
+
+        SwapHeapPositions(heap, position, parent);
+        position = parent;
+    }
+}
+
+void SiftHeapDown(PriorityHeap_t* heap, const FusedObjectStore_t* fusedObjectStore, u8_t position)
+{
+    u16_t child;
+    u8_t first;
+
+    for (;;)
+    {
+        first = position;
+        child = (2u * (u16_t)position) + 1u;
+
+        if ((child < heap->count) && IsHeapBefore(fusedObjectStore, heap->heap[child], heap->heap[first]))
+        {
+            first = (u8_t)child;
+        }
+
+        child++;
+
+        if ((child < heap->count) && IsHeapBefore(fusedObjectStore, heap->heap[child], heap->heap[first]))
+        {
+            first = (u8_t)child;
+        }
+
+        if (first == position)
+        {
+            break;
+        }
+
+        SwapHeapPositions(heap, position, first);
+        position = first;
+    }
+}
+
+/***************************** Public Functions ******************************/
+
+void ResetPriorityHeap(PriorityHeap_t* heap, const u8_t capacity)
+{
+    u32_t slot;
+
+    heap->capacity = capacity;
+    heap->count = 0u;
+
+    (void)memset(heap->position, INVALID_HEAP_POSITION, sizeof(heap->position));
+    (void)memset(heap->usedSlots, 0, sizeof(heap->usedSlots));
+
+    for (slot = capacity; slot < (NUM_SLOT_WORDS * BITMAP_WORD_BITS); slot++)
+    {
+        SetBitmapBit(heap->usedSlots, slot);
+    }
+}
+
+void BuildPriorityHeap(PriorityHeap_t* heap, const FusedObjectStore_t* fusedObjectStore)
+{
+    u8_t i;
+
+    ResetPriorityHeap(heap, heap->capacity);
+
+    for (i = GetNextLiveFusedObject(fusedObjectStore, 0u); i < NUM_FUSED_OBJ; i = GetNextLiveFusedObject(fusedObjectStore, i + 1u))
+    {
+        heap->heap[heap->count] = i;
+        heap->position[i] = heap->count;
+        heap->count++;
+
+        SetBitmapBit(heap->usedSlots, i);
+    }
+
+    for (i = (heap->count / 2u); i > 0u; i--)
+    {
+        SiftHeapDown(heap, fusedObjectStore, i - 1u);
+    }
+}
+
+void InsertHeapObject(PriorityHeap_t* heap, const FusedObjectStore_t* fusedObjectStore, const u8_t index)
+{
+    heap->heap[heap->count] = index;
+    heap->position[index] = heap->count;
+    heap->count++;
+
+    SetBitmapBit(heap->usedSlots, index);
+
+    SiftHeapUp(heap, fusedObjectStore, heap->position[index]);
+}
+
+void RemoveHeapObject(PriorityHeap_t* heap, const FusedObjectStore_t* fusedObjectStore, const u8_t index)
+{
+    u8_t position = heap->position[index];
+    u8_t moved;
+
+    if (position != INVALID_HEAP_POSITION)
+    {
+        heap->count--;
+
+        if (position != heap->count)
+        {
+            moved = heap->heap[heap->count];
+
+            SwapHeapPositions(heap, position, heap->count);
+
+            /* The last object moved to the hole may need to go either way. */
+            SiftHeapDown(heap, fusedObjectStore, position);
+            SiftHeapUp(heap, fusedObjectStore, heap->position[moved]);
+        }
+
+        heap->position[index] = INVALID_HEAP_POSITION;
+
+        ClearBitmapBit(heap->usedSlots, index);
+    }
+}
+
+u8_t GetHeapMinObject(const PriorityHeap_t* heap)
+{
+    return ((heap->count > 0u) ? heap->heap[0] : NUM_FUSED_OBJ);
+}
+
+u8_t GetHeapFreeSlot(const PriorityHeap_t* heap)
+{
+    u32_t slot = FindFirstZeroBit(heap->usedSlots, NUM_SLOT_WORDS);
+
+    return (slot < NUM_FUSED_OBJ) ? (u8_t)slot : NUM_FUSED_OBJ;
+}
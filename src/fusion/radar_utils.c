@@ -40,7 +40,7 @@
   * @param bearingVar The variance of the bearing.
   * @return The calculated variance.
   */
-static f32_t GetVarXPolar(const f32_t range, const f32_t bearing, const f32_t rangeVar, const f32_t bearingVar);
+static real_t GetVarXPolar(const real_t range, const real_t bearing, const real_t rangeVar, const real_t bearingVar);
 
 /**
   * @brief Calculates the variance in y of an object from polar coordinates.
@@ -51,7 +51,7 @@ static f32_t GetVarXPolar(const f32_t range, const f32_t bearing, const f32_t ra
   * @param bearingVar The variance of the bearing.
   * @return The calculated variance.
   */
-static f32_t GetVarYPolar(const f32_t range, const f32_t bearing, const f32_t rangeVar, const f32_t bearingVar);
+static real_t GetVarYPolar(const real_t range, const real_t bearing, const real_t rangeVar, const real_t bearingVar);
 
 /**
   * @brief Calculates the dissimilarity between two distributions.
@@ -64,30 +64,30 @@ static f32_t GetVarYPolar(const f32_t range, const f32_t bearing, const f32_t ra
   * @param variance2 The variance of the second distribution.
   * @return The calculated dissimilarity value.
   */
-static f32_t GetDissimilarityValue(const f32_t mean1, const f32_t mean2, const f32_t variance1, const f32_t variance2);
+static real_t GetDissimilarityValue(const real_t mean1, const real_t mean2, const real_t variance1, const real_t variance2);
 
 /***************************** Static Functions ******************************/
 
-f32_t GetVarXPolar(const f32_t range, const f32_t bearing, const f32_t rangeVar, const f32_t bearingVar)
+real_t GetVarXPolar(const real_t range, const real_t bearing, const real_t rangeVar, const real_t bearingVar)
 {
-    f32_t cosPhi2 = (f32_t)(cos(bearing) * cos(bearing));
-    f32_t sinPhi2 = (f32_t)(sin(bearing) * sin(bearing));
+    real_t cosPhi2 = REAL_COS(bearing) * REAL_COS(bearing);
+    real_t sinPhi2 = REAL_SIN(bearing) * REAL_SIN(bearing);
 
     return ((rangeVar * cosPhi2) + (range * range * bearingVar * sinPhi2));
 }
 
-f32_t GetVarYPolar(const f32_t range, const f32_t bearing, const f32_t rangeVar, const f32_t bearingVar)
+real_t GetVarYPolar(const real_t range, const real_t bearing, const real_t rangeVar, const real_t bearingVar)
 {
-    f32_t cosPhi2 = (f32_t)(cos(bearing) * cos(bearing));
-    f32_t sinPhi2 = (f32_t)(sin(bearing) * sin(bearing));
+    real_t cosPhi2 = REAL_COS(bearing) * REAL_COS(bearing);
+    real_t sinPhi2 = REAL_SIN(bearing) * REAL_SIN(bearing);
 
     return ((rangeVar * sinPhi2) + (range * range * bearingVar * cosPhi2));
 }
 
-f32_t GetDissimilarityValue(const f32_t mean1, const f32_t mean2, const f32_t variance1, const f32_t variance2)
+real_t GetDissimilarityValue(const real_t mean1, const real_t mean2, const real_t variance1, const real_t variance2)
 {
-    f32_t dissimilarity = INVALID_SIMILARITY_VALUE;
-    f32_t variance12 = variance1 + variance2;
+    real_t dissimilarity = INVALID_SIMILARITY_VALUE;
+    real_t variance12 = variance1 + variance2;
 
     if (variance12 != 0.f)
     {
@@ -99,38 +99,38 @@ f32_t GetDissimilarityValue(const f32_t mean1, const f32_t mean2, const f32_t va
 
 /***************************** Public Functions ******************************/
 
-f32_t GetRange(const f32_t posX, const f32_t posY)
+real_t GetRange(const real_t posX, const real_t posY)
 {
-    return sqrt(((posX)*(posX)) + ((posY)*(posY)));
+    return REAL_SQRT(((posX)*(posX)) + ((posY)*(posY)));
 }
 
-f32_t GetBearing(const f32_t posX, const f32_t posY)
+real_t GetBearing(const real_t posX, const real_t posY)
 {
-    return atan2(posY, posX);
+    return REAL_ATAN2(posY, posX);
 }
 
-f32_t GetVarX(const f32_t posX, const f32_t posY, const f32_t rangeVar, const f32_t bearingVar, const f32_t baseVar)
+real_t GetVarX(const real_t posX, const real_t posY, const real_t rangeVar, const real_t bearingVar, const real_t baseVar)
 {
-    f32_t range = GetRange(posX, posY);
-    f32_t bearing = GetBearing(posX, posY);
-    f32_t varX = GetVarXPolar(range, bearing, rangeVar, bearingVar);
+    real_t range = GetRange(posX, posY);
+    real_t bearing = GetBearing(posX, posY);
+    real_t varX = GetVarXPolar(range, bearing, rangeVar, bearingVar);
 
-    return fmax(baseVar, varX);
+    return REAL_FMAX(baseVar, varX);
 }
 
-f32_t GetVarY(const f32_t posX, const f32_t posY, const f32_t rangeVar, const f32_t bearingVar, const f32_t baseVar)
+real_t GetVarY(const real_t posX, const real_t posY, const real_t rangeVar, const real_t bearingVar, const real_t baseVar)
 {
-    f32_t range = GetRange(posX, posY);
-    f32_t bearing = GetBearing(posX, posY);
-    f32_t varY = GetVarYPolar(range, bearing, rangeVar, bearingVar);
+    real_t range = GetRange(posX, posY);
+    real_t bearing = GetBearing(posX, posY);
+    real_t varY = GetVarYPolar(range, bearing, rangeVar, bearingVar);
 
-    return fmax(baseVar, varY);
+    return REAL_FMAX(baseVar, varY);
 }
 
-f32_t GetSimilarityValue(const f32_t mean1, const f32_t mean2, const f32_t variance1, const f32_t variance2)
+real_t GetSimilarityValue(const real_t mean1, const real_t mean2, const real_t variance1, const real_t variance2)
 {
-    f32_t similarity;
-    f32_t dissimilarity = GetDissimilarityValue(mean1, mean2, variance1, variance2);
+    real_t similarity;
+    real_t dissimilarity = GetDissimilarityValue(mean1, mean2, variance1, variance2);
 
     if (dissimilarity == 0.f)
     {
@@ -144,7 +144,7 @@ f32_t GetSimilarityValue(const f32_t mean1, const f32_t mean2, const f32_t varia
     return similarity;
 }
 
-f32_t GetLinInterpolatedValue(const f32_t x, const f32_t x1, const f32_t x2, const f32_t y1, const f32_t y2)
+real_t GetLinInterpolatedValue(const real_t x, const real_t x1, const real_t x2, const real_t y1, const real_t y2)
 {
     return (((y2 - y1) / (x2 - x1)) * (x - x1) + y1);
 }
@@ -37,40 +37,45 @@
 
 /************************ Global Variable Definitions ************************/
 
-f32_t SIGMA_BASE    = 0.1f;
-f32_t SIGMA_RANGE   = 0.5f;
-f32_t SIGMA_DOPPLER = 1.5f;
-f32_t SIGMA_BEARING = 3.0f;
-
-f32_t MAX_BEARING_CONFIDENCE   = 1.0f;
-f32_t MIN_BEARING_CONFIDENCE   = 0.7f;
-f32_t SENSOR_WEAK_BEARING_AREA = 10.0f;
-
-f32_t Q_SIGMA_X  = 1.5f;
-f32_t Q_SIGMA_Y  = 1.5f;
-f32_t Q_SIGMA_VX = 3.0f;
-f32_t Q_SIGMA_VY = 3.0f;
-
-f32_t PRUNE_LIMIT_X  = 2.0f;
-f32_t PRUNE_LIMIT_Y  = 2.0f;
-f32_t PRUNE_LIMIT_VX = 5.0f;
-f32_t PRUNE_LIMIT_VY = 5.0f;
-
-f32_t GATING_WEIGHT_X  = 10.0f;
-f32_t GATING_WEIGHT_Y  = 10.0f;
-f32_t GATING_WEIGHT_VX = 30.0f;
-f32_t GATING_WEIGHT_VY = 30.0f;
-f32_t ACCEPTANCE_GATE_SUM_FACTOR = 1.0f;
+real_t SIGMA_BASE    = 0.1f;
+real_t SIGMA_RANGE   = 0.5f;
+real_t SIGMA_DOPPLER = 1.5f;
+real_t SIGMA_BEARING = 3.0f;
+
+real_t MAX_BEARING_CONFIDENCE   = 1.0f;
+real_t MIN_BEARING_CONFIDENCE   = 0.7f;
+real_t SENSOR_WEAK_BEARING_AREA = 10.0f;
+
+real_t Q_SIGMA_X  = 1.5f;
+real_t Q_SIGMA_Y  = 1.5f;
+real_t Q_SIGMA_VX = 3.0f;
+real_t Q_SIGMA_VY = 3.0f;
+
+real_t PRUNE_LIMIT_X  = 2.0f;
+real_t PRUNE_LIMIT_Y  = 2.0f;
+real_t PRUNE_LIMIT_VX = 5.0f;
+real_t PRUNE_LIMIT_VY = 5.0f;
+
+real_t GATING_WEIGHT_X  = 10.0f;
+real_t GATING_WEIGHT_Y  = 10.0f;
+real_t GATING_WEIGHT_VX = 30.0f;
+real_t GATING_WEIGHT_VY = 30.0f;
+real_t ACCEPTANCE_GATE_SUM_FACTOR = 1.0f;
 
 u8_t MAX_COASTING_CYCLES = 20u;
-f32_t MIN_COASTING_DIST  = 5.0f;
-f32_t MAX_COASTING_DIST  = 15.0f;
+real_t MIN_COASTING_DIST  = 5.0f;
+real_t MAX_COASTING_DIST  = 15.0f;
 
-f32_t MAX_VELOCITY = 19.2f;
-f32_t MIN_VELOCITY = 3.0f;
+real_t MAX_VELOCITY = 19.2f;
+real_t MIN_VELOCITY = 3.0f;
 
 u8_t MIN_LIFETIME_TX_CYCLES = 3u;
 
+u8_t UPDATE_MODE = 0u;
+
+u8_t ASSOCIATION_MODE = 0u;
+u16_t JPDA_MAX_HYPOTHESES = 1000u;
+
 /***************************** Public Functions ******************************/
 
 void CfgCallback(u8_t cfgSelect, f32_t cfgValue)
@@ -157,6 +162,15 @@ void CfgCallback(u8_t cfgSelect, f32_t cfgValue)
         case 25u:
             MIN_LIFETIME_TX_CYCLES = (u8_t)cfgValue;
             break;
+        case 26u:
+            UPDATE_MODE = (u8_t)cfgValue;
+            break;
+        case 27u:
+            ASSOCIATION_MODE = (u8_t)cfgValue;
+            break;
+        case 28u:
+            JPDA_MAX_HYPOTHESES = (u16_t)cfgValue;
+            break;
         default:
             valid = 0u;
             break;
@@ -164,6 +178,6 @@ void CfgCallback(u8_t cfgSelect, f32_t cfgValue)
 
     if (valid)
     {
-        InitializeAlgorithm();
+        (void)InitializeAlgorithm(GetAlgorithmConfig());
     }
 }
\ No newline at end of file
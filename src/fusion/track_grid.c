@@ -0,0 +1,236 @@
+/*
+ * Copyright (C) 2016 Dimitris Geromichalos
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+ /**
+  * A uniform grid (spatial hash) over the positions of the tracks.
+  * The acceptance gate of a plot only needs to be checked against the tracks
+  * of the cells around it, instead of all the tracks.
+  */
+
+/******************************** Inclusions *********************************/
+
+#include <math.h>
+#include <string.h>
+
+#include "constants.h"
+
+#include "track_grid.h"
+
+/************************ Static Function Prototypes *************************/
+
+/**
+  * @brief Gets the cell coordinate of a position.
+  * @details The coordinate is clamped to [-`GRID_MAX_CELL`, `GRID_MAX_CELL`].
+  * @param pos The position (x or y).
+  * @return The cell coordinate.
+  */
+static s32_t GetGridCell(const real_t pos);
+
+/**
+  * @brief Gets the bucket that a cell is hashed to.
+  * @param cellX The x coordinate of the cell.
+  * @param cellY The y coordinate of the cell.
+  * @return The bucket of the cell.
+  */
+static u8_t GetGridBucket(const s32_t cellX, const s32_t cellY);
+
+/***************************** Static Functions ******************************/
+
+s32_t GetGridCell(const real_t pos)
+{
+    real_t scaledPos = pos * (1.f / GRID_CELL_SIZE);
+    s32_t cell;
+
+    if (scaledPos > GRID_MAX_CELL)
+    {
+        scaledPos = GRID_MAX_CELL;
+    }
+    else if (scaledPos < -GRID_MAX_CELL)
+    {
+        scaledPos = -GRID_MAX_CELL;
+    }
+    else
+    {
+        /* Inside the limits. */
+    }
+
+    /* Floor, without the call to the math library. */
+    cell = (s32_t)scaledPos;
+
+    if ((real_t)cell > scaledPos)
+    {
+        cell--;
+    }
+
+    return cell;
+}
+
+u8_t GetGridBucket(const s32_t cellX, const s32_t cellY)
+{
+    u32_t hash = ((u32_t)cellX * 73856093u) ^ ((u32_t)cellY * 19349663u);
+
+    return (u8_t)(hash & (NUM_GRID_BUCKETS - 1u));
+}
+
+/***************************** Public Functions ******************************/
+
+void ResetTrackGrid(TrackGrid_t* grid)
+{
+    (void)memset(grid->head, INVALID_GRID_INDEX, sizeof(grid->head));
+    (void)memset(grid->next, INVALID_GRID_INDEX, sizeof(grid->next));
+    (void)memset(grid->bucket, INVALID_GRID_INDEX, sizeof(grid->bucket));
+    (void)memset(grid->maxVariance, 0, sizeof(grid->maxVariance));
+
+    grid->count = 0u;
+}
+
+void InsertGridTrack(TrackGrid_t* grid, const u8_t index, const real_t* X, const real_t* variance)
+{
+    u8_t i, state;
+    u8_t bucket = GetGridBucket(GetGridCell(X[STATE_X]), GetGridCell(X[STATE_Y]));
+
+    grid->bucket[index] = bucket;
+    grid->next[index] = grid->head[bucket];
+    grid->head[bucket] = index;
+    grid->count++;
+
+    for (i = 0u; i < KALMAN_AXES; i++)
+    {
+        state = GET_STATE_FROM_AXIS(i, 0u);
+
+        if (variance[state] > grid->maxVariance[i])
+        {
+            grid->maxVariance[i] = variance[state];
+        }
+    }
+}
+
+void MoveGridTrack(TrackGrid_t* grid, const u8_t index, const real_t* X, const real_t* variance)
+{
+    u8_t bucket = GetGridBucket(GetGridCell(X[STATE_X]), GetGridCell(X[STATE_Y]));
+    u8_t* link;
+
+    if (grid->bucket[index] == INVALID_GRID_INDEX)
+    {
+        InsertGridTrack(grid, index, X, variance);
+    }
+    else if (bucket != grid->bucket[index])
+    {
+        link = &grid->head[grid->bucket[index]];
+
+        while (*link != index)
+        {
+            link = &grid->next[*link];
+        }
+
+        *link = grid->next[index];
+
+        grid->bucket[index] = bucket;
+        grid->next[index] = grid->head[bucket];
+        grid->head[bucket] = index;
+    }
+    else
+    {
+        /* Still in the same bucket. */
+    }
+}
+
+void RemoveGridTrack(TrackGrid_t* grid, const u8_t index)
+{
+    u8_t bucket = grid->bucket[index];
+    u8_t* link;
+
+    if (bucket != INVALID_GRID_INDEX)
+    {
+        link = &grid->head[bucket];
+
+        while (*link != index)
+        {
+            link = &grid->next[*link];
+        }
+
+        *link = grid->next[index];
+
+        grid->next[index] = INVALID_GRID_INDEX;
+        grid->bucket[index] = INVALID_GRID_INDEX;
+        grid->count--;
+    }
+}
+
+u8_t GetGridCandidates(const TrackGrid_t* grid, const real_t posX, const real_t posY, const real_t radius2X, const real_t radius2Y, u8_t* candidates)
+{
+    s32_t cellX, cellY;
+    s32_t minCellX = 0, maxCellX = 0, minCellY = 0, maxCellY = 0;
+    real_t radiusX, radiusY;
+    u64_t buckets = 0u;
+    u8_t bucket, index;
+    u8_t count = 0u;
+    u8_t searchAll = (grid->count <= MIN_GRID_QUERY_TRACKS);
+
+    if (!searchAll)
+    {
+        radiusX = (radius2X > 0.f) ? (REAL_SQRT(radius2X) * GRID_RADIUS_MARGIN) : 0.f;
+        radiusY = (radius2Y > 0.f) ? (REAL_SQRT(radius2Y) * GRID_RADIUS_MARGIN) : 0.f;
+
+        minCellX = GetGridCell(posX - radiusX);
+        maxCellX = GetGridCell(posX + radiusX);
+        minCellY = GetGridCell(posY - radiusY);
+        maxCellY = GetGridCell(posY + radiusY);
+
+        searchAll = ((((u64_t)(maxCellX - minCellX) + 1u) * ((u64_t)(maxCellY - minCellY) + 1u)) > MAX_GRID_QUERY_CELLS);
+    }
+
+    if (searchAll)
+    {
+        /* Too few tracks, or most of the buckets would be visited anyway. */
+        for (index = 0u; index < NUM_FUSED_OBJ; index++)
+        {
+            if (grid->bucket[index] != INVALID_GRID_INDEX)
+            {
+                candidates[count] = index;
+                count++;
+            }
+        }
+    }
+    else
+    {
+        for (cellX = minCellX; cellX <= maxCellX; cellX++)
+        {
+            for (cellY = minCellY; cellY <= maxCellY; cellY++)
+            {
+                buckets |= ((u64_t)1u << GetGridBucket(cellX, cellY));
+            }
+        }
+
+        /* Each track is chained to exactly one bucket, so visiting each bucket once never repeats a track. */
+        for (bucket = 0u; buckets != 0u; bucket++)
+        {
+            if ((buckets & 1u) != 0u)
+            {
+                for (index = grid->head[bucket]; index != INVALID_GRID_INDEX; index = grid->next[index])
+                {
+                    candidates[count] = index;
+                    count++;
+                }
+            }
+
+            buckets >>= 1u;
+        }
+    }
+
+    return count;
+}
@@ -18,6 +18,10 @@
  /**
   * The tracker solves the filtering problem using a Linear Kalman Filter (LKF).
   * The LKF is implemented using 4 states: x, y, vx, vy.
+  *
+  * Since the motion model and the plots' noise do not couple the two axes,
+  * the LKF can alternatively be run as two independent 2-state filters
+  * (x/vx and y/vy), see `TRACKER_KERNEL`.
   
   * For each cycle, the steps of the LKF are:
   * 1. Predict the new states of a fused object (track).
@@ -38,46 +42,76 @@
 
 #include "tracking.h"
 
-/***************************** Static Variables ******************************/
-
-/** The state prediction matrix of the process. */
-static KalmanF_t F;
-
-/** The noise covariance matrix of the process. */
-static KalmanQ_t Q;
-
-/** The upper decomposed matrix of Q. */
-static KalmanQu_t Qu;
-
-/** The diagonal decomposed matrix of Q. */
-static KalmanQd_t Qd;
-
-/** The sensor transformation matrix (to the tracker's domain).*/
-static KalmanH_t H;
-
 /************************ Static Function Prototypes *************************/
 
 /**
   * @brief Initializes the F (state prediction) matrix of the Kalman filter.
   * @details The F matrix is calculated according to the model of an object's motion.
   *          Currently, a decoupled model is used (linear equation).
+  * @param F The state prediction matrix to be initialized.
   * @param dt The cycle time of the algo.
   * @return Void.
   */
-static void InitF(const f32_t dt);
+static void InitF(real_t* F, const real_t dt);
 
 /**
   * @brief Initializes the Q (noise covariance) matrix of the Kalman filter.
   * @details The Q matrix is calculated using user-defined parameters.
   *          The bigger the values of the matrix, the higher the uncertainty of the prediction will be.
+  * @param Q The noise covariance matrix to be initialized.
   * @param dt The cycle time of the algo.
   * @return Void.
   */
-static void InitQ(const f32_t dt);
+static void InitQ(real_t* Q, const real_t dt);
+
+/**
+  * @brief Initializes the process model (F and Q matrices) for a time step.
+  * @param process The process to be initialized.
+  * @param dt The time step.
+  * @return Void.
+  */
+static void InitProcess(TrackingProcess_t* process, const real_t dt);
+
+/**
+  * @brief Gets the key that a time step is cached with.
+  * @details The time step is clamped to [`MIN_DELTA_TIME`, `MAX_DELTA_TIME`]
+  *          and quantized to `DELTA_TIME_STEPS_PER_SEC`, so the key is never zero.
+  * @param dt The time step.
+  * @return The key of the time step.
+  */
+static u16_t GetDeltaTimeKey(const real_t dt);
+
+#if (TRACKER_KERNEL == TRACKER_KERNEL_DECOUPLED)
+/**
+  * @brief Initializes the Q (noise covariance) matrices of each axis of the decoupled Kalman filter.
+  * @details The diagonal blocks of Q that belong to each axis are extracted.
+  * @param process The process whose Q matrix is split to the axes.
+  * @return Void.
+  */
+static void InitAxisQ(TrackingProcess_t* process);
+#elif (TRACK_STORAGE == TRACK_STORAGE_COMPACT)
+/**
+  * @brief Unpacks the upper factor of a compact track.
+  * @details The unit diagonal is restored, so that the factor can be used by the Kalman functions.
+  * @param track The compact track.
+  * @param U The upper factor (including the diagonal).
+  * @return Void.
+  */
+static void UnpackTrackFactor(const Track_t* track, real_t* U);
+
+/**
+  * @brief Packs the upper factor to a compact track.
+  * @details Only the strictly upper part is stored, the unit diagonal is dropped.
+  * @param U The upper factor (including the diagonal).
+  * @param track The compact track.
+  * @return Void.
+  */
+static void PackTrackFactor(const real_t* U, Track_t* track);
+#endif
 
 /***************************** Static Functions ******************************/
 
-void InitF(const f32_t dt)
+void InitF(real_t* F, const real_t dt)
 {
     (void)memset(F, 0, sizeof(KalmanF_t));
 
@@ -92,12 +126,12 @@ void InitF(const f32_t dt)
     F[(KALMAN_STATES * STATE_VY) + STATE_VY] = 1.f;
 }
 
-void InitQ(const f32_t dt)
+void InitQ(real_t* Q, const real_t dt)
 {
-    f32_t var_q_x = Q_SIGMA_X * Q_SIGMA_X;
-    f32_t var_q_y = Q_SIGMA_Y * Q_SIGMA_Y;
-    f32_t var_q_vx = Q_SIGMA_VX * Q_SIGMA_VX;
-    f32_t var_q_vy = Q_SIGMA_VY * Q_SIGMA_VY;
+    real_t var_q_x = Q_SIGMA_X * Q_SIGMA_X;
+    real_t var_q_y = Q_SIGMA_Y * Q_SIGMA_Y;
+    real_t var_q_vx = Q_SIGMA_VX * Q_SIGMA_VX;
+    real_t var_q_vy = Q_SIGMA_VY * Q_SIGMA_VY;
 
     (void)memset(Q, 0, sizeof(KalmanQ_t));
   
@@ -114,56 +148,595 @@ void InitQ(const f32_t dt)
     Q[(KALMAN_STATES * STATE_VY) + STATE_Y]  = Q[(KALMAN_STATES * STATE_Y) + STATE_VY];
 }
 
+void InitProcess(TrackingProcess_t* process, const real_t dt)
+{
+    InitF(process->F, dt);
+
+    InitQ(process->Q, dt);
+
+#if (TRACKER_KERNEL == TRACKER_KERNEL_DECOUPLED)
+    process->dt = dt;
+
+    InitAxisQ(process);
+#else
+    (void)DecomposeUD((const real_t*) process->Q, process->Qu, process->Qd);
+#endif
+}
+
+u16_t GetDeltaTimeKey(const real_t dt)
+{
+    real_t clampedDt = dt;
+
+    if (clampedDt < MIN_DELTA_TIME)
+    {
+        clampedDt = MIN_DELTA_TIME;
+    }
+    else if (clampedDt > MAX_DELTA_TIME)
+    {
+        clampedDt = MAX_DELTA_TIME;
+    }
+
+    return (u16_t)((clampedDt * (real_t)DELTA_TIME_STEPS_PER_SEC) + 0.5f);
+}
+
+#if (TRACKER_KERNEL == TRACKER_KERNEL_DECOUPLED)
+void InitAxisQ(TrackingProcess_t* process)
+{
+    u8_t i;
+    u8_t pos, vel;
+
+    for (i = 0u; i < KALMAN_AXES; i++)
+    {
+        pos = GET_STATE_FROM_AXIS(i, 0u);
+        vel = GET_STATE_FROM_AXIS(i, 1u);
+
+        process->Qaxis[i][GET_UPPER_INDEX(0u, 0u, AXIS_STATES)] = process->Q[(KALMAN_STATES * pos) + pos];
+        process->Qaxis[i][GET_UPPER_INDEX(0u, 1u, AXIS_STATES)] = process->Q[(KALMAN_STATES * pos) + vel];
+        process->Qaxis[i][GET_UPPER_INDEX(1u, 1u, AXIS_STATES)] = process->Q[(KALMAN_STATES * vel) + vel];
+    }
+}
+#elif (TRACK_STORAGE == TRACK_STORAGE_COMPACT)
+void UnpackTrackFactor(const Track_t* track, real_t* U)
+{
+    u8_t i, j;
+    u8_t k = 0u;
+
+    for (i = 0u; i < KALMAN_STATES; i++)
+    {
+        U[GET_UPPER_INDEX(i, i, KALMAN_STATES)] = 1.f;
+
+        for (j = (i + 1u); j < KALMAN_STATES; j++)
+        {
+            U[GET_UPPER_INDEX(i, j, KALMAN_STATES)] = track->P_US[k];
+            k++;
+        }
+    }
+}
+
+void PackTrackFactor(const real_t* U, Track_t* track)
+{
+    u8_t i, j;
+    u8_t k = 0u;
+
+    for (i = 0u; i < KALMAN_STATES; i++)
+    {
+        for (j = (i + 1u); j < KALMAN_STATES; j++)
+        {
+            track->P_US[k] = U[GET_UPPER_INDEX(i, j, KALMAN_STATES)];
+            k++;
+        }
+    }
+}
+#endif
+
 /***************************** Public Functions ******************************/
 
-void InitializeTracking(const f32_t dt)
+void InitializeTracking(TrackingModel_t* model, const real_t dt)
+{
+    (void)memset(model, 0, sizeof(TrackingModel_t));
+
+    (void)GetTrackingProcess(model, dt);
+}
+
+const TrackingProcess_t* GetTrackingProcess(TrackingModel_t* model, const real_t dt)
+{
+    u8_t i;
+    u8_t entry = NUM_CACHED_PROCESSES;
+    u16_t key = GetDeltaTimeKey(dt);
+
+    for (i = 0u; i < NUM_CACHED_PROCESSES; i++)
+    {
+        if (model->keys[i] == key)
+        {
+            entry = i;
+            break;
+        }
+    }
+
+    if (entry == NUM_CACHED_PROCESSES)
+    {
+        entry = model->nextEntry;
+        model->nextEntry = (u8_t)((entry + 1u) % NUM_CACHED_PROCESSES);
+
+        model->keys[entry] = key;
+        InitProcess(&model->processes[entry], (real_t)key / (real_t)DELTA_TIME_STEPS_PER_SEC);
+    }
+
+    return &model->processes[entry];
+}
+
+void AccumulatePlotInformation(PlotInformation_t* information, const Plot_t* plot)
 {
-    InitF(dt);
+    u8_t i;
+    real_t inverseNoise;
 
-    InitQ(dt);
+    if (plot->weight > 0.f)
+    {
+        for (i = 0u; i < KALMAN_STATES; i++)
+        {
+            inverseNoise = plot->weight / plot->R[(KALMAN_STATES * i) + i];
+
+            information->Y[i] += inverseNoise;
+            information->y[i] += inverseNoise * plot->Z[i];
+        }
 
-    (void)DecomposeUD((const f32_t*) Q, Qu, Qd);
+        information->count++;
+    }
 }
 
+void FusePlotInformation(Track_t* track, const PlotInformation_t* information)
+{
+    u8_t i;
+    Plot_t plot;
+
+    if (information->count > 0u)
+    {
+        (void)memset(&plot, 0, sizeof(Plot_t));
+
+        for (i = 0u; i < KALMAN_STATES; i++)
+        {
+            plot.R[(KALMAN_STATES * i) + i] = 1.f / information->Y[i];
+            plot.Z[i] = information->y[i] * plot.R[(KALMAN_STATES * i) + i];
+        }
+
+        plot.weight = 1.f;
+
+        FuseTrack(track, &plot);
+    }
+}
+
+#if (TRACKER_KERNEL == TRACKER_KERNEL_DECOUPLED)
+
 void InitializeTrack(Track_t* track, const Plot_t* plot)
 {
     u8_t i;
+    u8_t pos, vel;
+
+    for (i = 0u; i < KALMAN_STATES; i++)
+    {
+        track->X[i] = plot->Z[i];
+    }
+
+    for (i = 0u; i < KALMAN_AXES; i++)
+    {
+        pos = GET_STATE_FROM_AXIS(i, 0u);
+        vel = GET_STATE_FROM_AXIS(i, 1u);
+
+        track->P_AXIS[i][GET_UPPER_INDEX(0u, 0u, AXIS_STATES)] = plot->R[(KALMAN_STATES * pos) + pos];
+        track->P_AXIS[i][GET_UPPER_INDEX(0u, 1u, AXIS_STATES)] = 0.f;
+        track->P_AXIS[i][GET_UPPER_INDEX(1u, 1u, AXIS_STATES)] = plot->R[(KALMAN_STATES * vel) + vel];
+    }
+}
+
+void PredictTrack(const TrackingProcess_t* process, Track_t* track)
+{
+    u8_t i;
+
+    for (i = 0u; i < KALMAN_AXES; i++)
+    {
+        PredictAxis(process->dt, process->Qaxis[i], &track->X[GET_STATE_FROM_AXIS(i, 0u)], &track->X[GET_STATE_FROM_AXIS(i, 1u)], track->P_AXIS[i]);
+    }
+}
+
+void FuseTrack(Track_t* track, const Plot_t* plot)
+{
+    u8_t i;
+    u8_t axis;
+    real_t innovation;
+
+    for (i = 0u; i < KALMAN_STATES; i++)
+    {
+        axis = GET_STATE_AXIS(i);
+
+        innovation = plot->Z[i] - track->X[i];
+        innovation *= plot->weight;
+
+        FuseAxis(innovation, plot->R[(KALMAN_STATES * i) + i], GET_AXIS_STATE(i),
+            &track->X[GET_STATE_FROM_AXIS(axis, 0u)], &track->X[GET_STATE_FROM_AXIS(axis, 1u)], track->P_AXIS[axis]);
+    }
+}
+
+void SetBatchTrack(TrackBatch_t* batch, const u8_t lane, const Track_t* track)
+{
+    u8_t i, j;
+
+    for (i = 0u; i < KALMAN_STATES; i++)
+    {
+        batch->X[i][lane] = track->X[i];
+    }
+
+    for (i = 0u; i < KALMAN_AXES; i++)
+    {
+        for (j = 0u; j < GET_SIZE_UPPER(AXIS_STATES); j++)
+        {
+            batch->P_AXIS[i][j][lane] = track->P_AXIS[i][j];
+        }
+    }
+}
+
+void GetBatchTrack(const TrackBatch_t* batch, const u8_t lane, Track_t* track)
+{
+    u8_t i, j;
+
+    for (i = 0u; i < KALMAN_STATES; i++)
+    {
+        track->X[i] = batch->X[i][lane];
+    }
+
+    for (i = 0u; i < KALMAN_AXES; i++)
+    {
+        for (j = 0u; j < GET_SIZE_UPPER(AXIS_STATES); j++)
+        {
+            track->P_AXIS[i][j] = batch->P_AXIS[i][j][lane];
+        }
+    }
+}
+
+void PredictTracks(const TrackingProcess_t* process, TrackBatch_t* batch)
+{
+    u8_t lane;
+#ifdef VECTOR_EXTENSIONS
+    u8_t i, j, valid;
+    vreal_t X[KALMAN_STATES];
+    vreal_t P[GET_SIZE_UPPER(AXIS_STATES)];
+
+    for (lane = 0u; lane < batch->count; lane += VECTOR_LANES)
+    {
+        valid = batch->count - lane;
+
+        for (i = 0u; i < KALMAN_STATES; i++)
+        {
+            X[i] = LoadLanes(&batch->X[i][lane], valid);
+        }
+
+        for (i = 0u; i < KALMAN_AXES; i++)
+        {
+            for (j = 0u; j < GET_SIZE_UPPER(AXIS_STATES); j++)
+            {
+                P[j] = LoadLanes(&batch->P_AXIS[i][j][lane], valid);
+            }
+
+            PredictAxisLanes(process->dt, process->Qaxis[i], &X[GET_STATE_FROM_AXIS(i, 0u)], &X[GET_STATE_FROM_AXIS(i, 1u)], P);
+
+            for (j = 0u; j < GET_SIZE_UPPER(AXIS_STATES); j++)
+            {
+                StoreLanes(&batch->P_AXIS[i][j][lane], P[j], valid);
+            }
+        }
+
+        for (i = 0u; i < KALMAN_STATES; i++)
+        {
+            StoreLanes(&batch->X[i][lane], X[i], valid);
+        }
+    }
+#else
+    Track_t track;
+
+    for (lane = 0u; lane < batch->count; lane++)
+    {
+        GetBatchTrack(batch, lane, &track);
+        PredictTrack(process, &track);
+        SetBatchTrack(batch, lane, &track);
+    }
+#endif
+}
+
+real_t GetTrackVariance(const Track_t* track, const u8_t state)
+{
+    u8_t axisState = GET_AXIS_STATE(state);
+
+    return track->P_AXIS[GET_STATE_AXIS(state)][GET_UPPER_INDEX(axisState, axisState, AXIS_STATES)];
+}
+
+void GetTrackCovariance(const Track_t* track, real_t* P)
+{
+    u8_t i;
+    u8_t pos, vel;
+
+    (void)memset(P, 0, sizeof(KalmanP_t));
+
+    for (i = 0u; i < KALMAN_AXES; i++)
+    {
+        pos = GET_STATE_FROM_AXIS(i, 0u);
+        vel = GET_STATE_FROM_AXIS(i, 1u);
+
+        P[(KALMAN_STATES * pos) + pos] = track->P_AXIS[i][GET_UPPER_INDEX(0u, 0u, AXIS_STATES)];
+        P[(KALMAN_STATES * pos) + vel] = track->P_AXIS[i][GET_UPPER_INDEX(0u, 1u, AXIS_STATES)];
+        P[(KALMAN_STATES * vel) + pos] = track->P_AXIS[i][GET_UPPER_INDEX(0u, 1u, AXIS_STATES)];
+        P[(KALMAN_STATES * vel) + vel] = track->P_AXIS[i][GET_UPPER_INDEX(1u, 1u, AXIS_STATES)];
+    }
+}
+
+#else
+
+#if (TRACK_STORAGE == TRACK_STORAGE_COMPACT)
+
+void InitializeTrack(Track_t* track, const Plot_t* plot)
+{
+    u8_t i;
+    KalmanP_t P;
+    KalmanPu_t U;
     
     (void)memset(track->X, 0, sizeof(KalmanX_t));
-    (void)memset(track->P, 0, sizeof(KalmanP_t));
+    (void)memset(P, 0, sizeof(KalmanP_t));
     
     for (i = 0u; i < KALMAN_STATES; i++)
     {
         track->X[i] = plot->Z[i];
 
-        track->P[(KALMAN_STATES * i) + i] = plot->R[(KALMAN_STATES * i) + i];
+        P[(KALMAN_STATES * i) + i] = plot->R[(KALMAN_STATES * i) + i];
     }
         
-    (void)DecomposeUD(track->P, track->P_U, track->P_D);
+    (void)DecomposeUD((const real_t*) P, U, track->P_D);
+
+    PackTrackFactor(U, track);
 }
 
-void PredictTrack(Track_t* track)
+void PredictTrack(const TrackingProcess_t* process, Track_t* track)
 {
-    (void)EstimateCovariance((const f32_t*) F, Qu, Qd, track->P_U, track->P_D);
+    KalmanWorkspace_t workspace;
+    KalmanPu_t U;
+
+    UnpackTrackFactor(track, U);
 
-    (void)PredictState(F, track->X);
+    (void)EstimateCovariance((const real_t*) process->F, process->Qu, process->Qd, U, track->P_D, &workspace);
 
-    (void)ComposeUD(track->P_U, track->P_D, (f32_t*) track->P);
+    (void)PredictState(process->F, track->X);
+
+    PackTrackFactor(U, track);
 }
 
 void FuseTrack(Track_t* track, const Plot_t* plot)
 {
     u8_t i;
-    f32_t innovation;
+    real_t noise[KALMAN_STATES];
+    KalmanPu_t U;
     
     for (i = 0u; i < KALMAN_STATES; i++)
     {
-        (void)memset(H, 0, sizeof(KalmanH_t));
-        H[i] = 1.f;
+        noise[i] = plot->R[(KALMAN_STATES * i) + i];
+    }
 
-        innovation = plot->Z[i] - track->X[i];
-        innovation *= plot->weight;
+    UnpackTrackFactor(track, U);
+
+    (void)FuseUnitStates(plot->Z, noise, plot->weight, track->X, U, track->P_D);
+
+    PackTrackFactor(U, track);
+}
+
+void SetBatchTrack(TrackBatch_t* batch, const u8_t lane, const Track_t* track)
+{
+    u8_t i;
+    KalmanPu_t U;
+
+    UnpackTrackFactor(track, U);
 
-        (void)FuseState(innovation, plot->R[(KALMAN_STATES * i) + i], (const f32_t*) H, track->X, track->P_U, track->P_D);
+    for (i = 0u; i < KALMAN_STATES; i++)
+    {
+        batch->X[i][lane] = track->X[i];
+        batch->P_D[i][lane] = track->P_D[i];
+    }
+
+    for (i = 0u; i < GET_SIZE_UPPER(KALMAN_STATES); i++)
+    {
+        batch->P_U[i][lane] = U[i];
+    }
+}
+
+void GetBatchTrack(const TrackBatch_t* batch, const u8_t lane, Track_t* track)
+{
+    u8_t i;
+    KalmanPu_t U;
+
+    for (i = 0u; i < KALMAN_STATES; i++)
+    {
+        track->X[i] = batch->X[i][lane];
+        track->P_D[i] = batch->P_D[i][lane];
+    }
+
+    for (i = 0u; i < GET_SIZE_UPPER(KALMAN_STATES); i++)
+    {
+        U[i] = batch->P_U[i][lane];
+    }
+
+    PackTrackFactor(U, track);
+}
+
+#else
+
+void InitializeTrack(Track_t* track, const Plot_t* plot)
+{
+    u8_t i;
+    KalmanP_t P;
+    
+    (void)memset(track->X, 0, sizeof(KalmanX_t));
+    (void)memset(P, 0, sizeof(KalmanP_t));
+    
+    for (i = 0u; i < KALMAN_STATES; i++)
+    {
+        track->X[i] = plot->Z[i];
+
+        P[(KALMAN_STATES * i) + i] = plot->R[(KALMAN_STATES * i) + i];
+        track->P_V[i] = P[(KALMAN_STATES * i) + i];
     }
+        
+    (void)DecomposeUD((const real_t*) P, track->P_U, track->P_D);
 }
+
+void PredictTrack(const TrackingProcess_t* process, Track_t* track)
+{
+    KalmanWorkspace_t workspace;
+
+    (void)EstimateCovariance((const real_t*) process->F, process->Qu, process->Qd, track->P_U, track->P_D, &workspace);
+
+    (void)PredictState(process->F, track->X);
+
+    (void)ComposeDiagonalUD(track->P_U, track->P_D, track->P_V);
+}
+
+void FuseTrack(Track_t* track, const Plot_t* plot)
+{
+    u8_t i;
+    real_t noise[KALMAN_STATES];
+    
+    for (i = 0u; i < KALMAN_STATES; i++)
+    {
+        noise[i] = plot->R[(KALMAN_STATES * i) + i];
+    }
+
+    (void)FuseUnitStates(plot->Z, noise, plot->weight, track->X, track->P_U, track->P_D);
+}
+
+void SetBatchTrack(TrackBatch_t* batch, const u8_t lane, const Track_t* track)
+{
+    u8_t i;
+
+    for (i = 0u; i < KALMAN_STATES; i++)
+    {
+        batch->X[i][lane] = track->X[i];
+        batch->P_V[i][lane] = track->P_V[i];
+        batch->P_D[i][lane] = track->P_D[i];
+    }
+
+    for (i = 0u; i < GET_SIZE_UPPER(KALMAN_STATES); i++)
+    {
+        batch->P_U[i][lane] = track->P_U[i];
+    }
+}
+
+void GetBatchTrack(const TrackBatch_t* batch, const u8_t lane, Track_t* track)
+{
+    u8_t i;
+
+    for (i = 0u; i < KALMAN_STATES; i++)
+    {
+        track->X[i] = batch->X[i][lane];
+        track->P_V[i] = batch->P_V[i][lane];
+        track->P_D[i] = batch->P_D[i][lane];
+    }
+
+    for (i = 0u; i < GET_SIZE_UPPER(KALMAN_STATES); i++)
+    {
+        track->P_U[i] = batch->P_U[i][lane];
+    }
+}
+
+#endif
+
+void PredictTracks(const TrackingProcess_t* process, TrackBatch_t* batch)
+{
+    u8_t lane;
+#ifdef VECTOR_EXTENSIONS
+    u8_t i, valid;
+    vreal_t X[KALMAN_STATES];
+    vreal_t V[GET_SIZE_DIAGONAL(KALMAN_STATES)];
+    vreal_t U[GET_SIZE_UPPER(KALMAN_STATES)];
+    vreal_t D[GET_SIZE_DIAGONAL(KALMAN_STATES)];
+
+    for (lane = 0u; lane < batch->count; lane += VECTOR_LANES)
+    {
+        valid = batch->count - lane;
+
+        for (i = 0u; i < KALMAN_STATES; i++)
+        {
+            X[i] = LoadLanes(&batch->X[i][lane], valid);
+            D[i] = LoadLanes(&batch->P_D[i][lane], valid);
+        }
+
+        for (i = 0u; i < GET_SIZE_UPPER(KALMAN_STATES); i++)
+        {
+            U[i] = LoadLanes(&batch->P_U[i][lane], valid);
+        }
+
+        EstimateCovarianceLanes((const real_t*) process->F, process->Qu, process->Qd, U, D);
+
+        PredictStateLanes(process->F, X);
+
+        ComposeDiagonalUDLanes(U, D, V);
+
+        for (i = 0u; i < KALMAN_STATES; i++)
+        {
+            StoreLanes(&batch->X[i][lane], X[i], valid);
+            StoreLanes(&batch->P_V[i][lane], V[i], valid);
+            StoreLanes(&batch->P_D[i][lane], D[i], valid);
+        }
+
+        for (i = 0u; i < GET_SIZE_UPPER(KALMAN_STATES); i++)
+        {
+            StoreLanes(&batch->P_U[i][lane], U[i], valid);
+        }
+    }
+#else
+    Track_t track;
+
+    for (lane = 0u; lane < batch->count; lane++)
+    {
+        GetBatchTrack(batch, lane, &track);
+        PredictTrack(process, &track);
+        SetBatchTrack(batch, lane, &track);
+    }
+#endif
+}
+
+#if (TRACK_STORAGE == TRACK_STORAGE_COMPACT)
+
+real_t GetTrackVariance(const Track_t* track, const u8_t state)
+{
+    u8_t j;
+    u8_t k = (u8_t)(GET_UPPER_INDEX(state, state, KALMAN_STATES) - state);
+    real_t variance = track->P_D[state];
+
+    /* P(i,i) = D(i) + sum(U(i,j)^2 * D(j)), for j > i */
+    for (j = (state + 1u); j < KALMAN_STATES; j++)
+    {
+        variance += track->P_US[k] * track->P_US[k] * track->P_D[j];
+        k++;
+    }
+
+    return variance;
+}
+
+void GetTrackCovariance(const Track_t* track, real_t* P)
+{
+    KalmanPu_t U;
+
+    UnpackTrackFactor(track, U);
+
+    (void)ComposeUD(U, track->P_D, P);
+}
+
+#else
+
+real_t GetTrackVariance(const Track_t* track, const u8_t state)
+{
+    return track->P_V[state];
+}
+
+void GetTrackCovariance(const Track_t* track, real_t* P)
+{
+    (void)ComposeUD(track->P_U, track->P_D, P);
+}
+
+#endif
+
+#endif
@@ -217,14 +217,9 @@ void InitializeCanInterface(void)
         /* return 0; */
 }
 
-void CopyPrefusedFrameList(u8_t* receivedList, CanFrame_t* frameList)
+const CanFrame_t* GetPrefusedFrame(const u8_t index)
 {
-        /* (void)pthread_mutex_lock(&mutex_irq); */
-
-        (void)memcpy(receivedList, prefusedFrameReceived, sizeof(u8_t) * (u32_t)NUM_RX_OBJS);
-        (void)memcpy(frameList, rxFrameList, sizeof(CanFrame_t) * (u32_t)NUM_RX_OBJS);
-
-        /* (void)pthread_mutex_unlock(&mutex_irq); */
+        return prefusedFrameReceived[index] ? &rxFrameList[index] : NULL;
 }
 
 void TransmitCanFrame(CanFrame_t* canFrame)
@@ -246,6 +241,8 @@ void ResetRxBuffers(void)
 
 void* CAN_IRQ_TASK(void* ptr)
 {
+        f32_t cfgValue;
+
         while (1)
         {
                 /* (void)pthread_mutex_lock(&mutex_socket); */
@@ -267,7 +264,9 @@ void* CAN_IRQ_TASK(void* ptr)
                                 {
                                     (void)memcpy(cfgFrame.data8, &rxFrame.data[0], sizeof(u8_t) * rxFrame.len);
 
-                                    CfgCallback((u8_t)cfgFrame.data8[4], *(f32_t*)&cfgFrame.data32[0]);
+                                    (void)memcpy(&cfgValue, &cfgFrame.data32[0], sizeof(f32_t));
+
+                                    CfgCallback((u8_t)cfgFrame.data8[4], cfgValue);
                                 }
 
                                 if (MapIdToIndexRx(&frameListIndex, (u16_t)(rxFrame.can_id)))
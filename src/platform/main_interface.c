@@ -24,13 +24,14 @@
   * output object list to CAN buffers that are transmitted synchronously.
   *
   * The main role of this module is to convert to and from frame (raw) lists to object lists.
-  * The cycle looks like: CAN (Rx) -> prefusedFrameList -> prefusedObjectlist -> fusion
+  * The cycle looks like: CAN (Rx) -> prefused objects of the algo (decoded in place) -> fusion
   *                       -> fusedObjectList -> fusedFrameList -> CAN (Tx)
   */
 
 /******************************** Inclusions *********************************/
 
 #include <string.h>
+#include <time.h>
 
 #include "algorithm_interface.h"
 
@@ -47,31 +48,29 @@
 /** The list that contains all the input sensors of the system. */
 static Sensor_t sensorList[NUM_SENSORS];
 
-/** The flag array containing the reception status of each frame for a cycle. */
-static u8_t prefusedObjectReceived[NUM_RX_OBJS];
-
-/** The list that holds the prefused frames received from the CAN module. */
-static CanFrame_t prefusedFrameList[NUM_RX_OBJS];
-
-/** The list that contains the prefused objects and is inputted to the algorithm. */
-static BaseObject_t prefusedObjectList[NUM_RX_OBJS];
+/**
+  * The capacities of the algorithm, as set by the CAN matrices of the platform.
+  * The lists of the algorithm are static, so they are locked in memory along with the rest at startup.
+  */
+static const AlgorithmConfig_t algorithmConfig =
+{
+    /* .numPrefusedObjects = */ NUM_RX_OBJS,
+    /* .numFusedObjects = */ NUM_TX_OBJS,
+    /* .numSensors = */ NUM_SENSORS,
+    /* .maxId = */ MAX_ID,
+};
 
 /** The list that contains the fused objects and is outputted from the algorithm. */
 static BaseObject_t fusedObjectList[NUM_TX_OBJS];
 
+/** The time that the algorithm was last executed (zero before the first execution). */
+static struct timespec lastAlgoTime;
+
 /** The CAN frame that is used to transmit the fused objects one by one. */
 static CanFrame_t txFrame;
 
 /************************ Static Function Prototypes *************************/
 
-/**
-  * @brief Reset all the buffers related to prefusion data.
-  * @details All the buffers are cleared in order to prepare for the reception
-  *          of new data in the next cycle.
-  * @return Void.
-  */
-static void ResetPrefusedBuffers(void);
-
 /**
   * @brief Reset all the buffers related to fusion data.
   * @details All the buffers are cleared in order to prepare for the reception
@@ -82,12 +81,6 @@ static void ResetFusedBuffers(void);
 
 /***************************** Static Functions ******************************/
 
-void ResetPrefusedBuffers(void)
-{
-    (void)memset(prefusedFrameList, 0, sizeof(CanFrame_t) * (u32_t)NUM_RX_OBJS);
-    (void)memset(prefusedObjectList, 0, sizeof(BaseObject_t) * (u32_t)NUM_RX_OBJS);
-}
-
 void ResetFusedBuffers(void)
 {
     (void)memset(fusedObjectList, 0, sizeof(BaseObject_t) * (u32_t)NUM_TX_OBJS);
@@ -100,28 +93,42 @@ void Initialize(void)
     InitializeCanInterface();
     InitializeSensorInterface(sensorList);
 
-    InitializeAlgorithm();
+    (void)InitializeAlgorithm(&algorithmConfig);
 }
 
-void CopyPrefusedData(void)
+void DecodePrefusedData(void)
 {
     u8_t i;
     Sensor_t* sensor = NULL;
-
-    CopyPrefusedFrameList(prefusedObjectReceived, prefusedFrameList);
+    const CanFrame_t* frame;
 
     for (i = 0; i < NUM_RX_OBJS; i++)
     {
-        if (GetSensorFromIndex(i, &sensor))
+        frame = GetPrefusedFrame(i);
+
+        if ((frame != NULL) && GetSensorFromIndex(i, &sensor))
         {
-            sensor->objects.GetObject(prefusedObjectReceived[i], prefusedFrameList[i].data8, &prefusedObjectList[i]);
+            sensor->objects.DecodeObject(i, frame->data8);
         }
     }
 }
 
 void ExecuteFusionAlgo(void)
 {
-    RunAlgorithm(prefusedObjectList, fusedObjectList);
+    struct timespec currentAlgoTime;
+    f32_t dt = CYCLE_TIME;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &currentAlgoTime);
+
+    if ((lastAlgoTime.tv_sec != 0) || (lastAlgoTime.tv_nsec != 0))
+    {
+        dt = (f32_t)(currentAlgoTime.tv_sec - lastAlgoTime.tv_sec) +
+             ((f32_t)(currentAlgoTime.tv_nsec - lastAlgoTime.tv_nsec) * 1e-9f);
+    }
+
+    lastAlgoTime = currentAlgoTime;
+
+    RunAlgorithmOnInputObjects(fusedObjectList, dt);
 }
 
 void PublishFusedData(void)
@@ -169,6 +176,5 @@ void PublishFusedData(void)
     }
 
     ResetRxBuffers();
-    ResetPrefusedBuffers();
     ResetFusedBuffers();
 }
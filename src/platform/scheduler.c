@@ -233,7 +233,7 @@ void SYNC_SUBTASK(void)
 
 void RECV_SUBTASK(void)
 {
-        CopyPrefusedData();
+        DecodePrefusedData();
 }
 
 void ALGO_SUBTASK(void)
@@ -17,42 +17,39 @@
 
  /**
   * Registers all the sensors of the system and implements the functions needed
-  * to extract and convert the raw CAN frames from the sensors to objects.
+  * to extract and convert the raw CAN frames from the sensors to objects,
+  * which are decoded straight to the input objects of the algorithm.
   */
 
 /******************************** Inclusions *********************************/
 
 #include <string.h>
 
+#include "algorithm_interface.h"
+
 #include "sensor_interface.h"
 
 /************************ Static Function Prototypes *************************/
 
 /**
-  * @brief Creates a prefused object from a CAN frame.
-  * @details If a frame was not received in this cycle, the prefused object's
-  *          attributes take the default values. Otherwise the frame's signals
-  *          are extracted into decimal values and then converted to the
-  *          physical domain.
-  * @param frameReceived Whether a CAN frame was received this cycle.
+  * @brief Decodes a received CAN frame straight to an input object of the algorithm.
+  * @details The frame's signals are extracted into decimal values and then converted to the
+  *          physical domain. Frames of an unknown (zero) object ID carry no object and are skipped.
+  * @param index The index of the frame in the Rx buffers.
   * @param canData The data contained in the CAN frame.
-  * @param prefusedObject The prefused object to be filled.
   * @return Void.
   */
-static void GetFrontRadarObject(const u8_t frameReceived, const u8_t* canData, BaseObject_t* prefusedObject);
+static void DecodeFrontRadarObject(const u8_t index, const u8_t* canData);
 
 /**
-  * @brief Creates a prefused object from a CAN frame.
-  * @details If a frame was not received in this cycle, the prefused object's
-  *          attributes take the default values. Otherwise the frame's signals
-  *          are extracted into decimal values and then converted to the
-  *          physical domain.
-  * @param frameReceived Whether a CAN frame was received this cycle.
+  * @brief Decodes a received CAN frame straight to an input object of the algorithm.
+  * @details The frame's signals are extracted into decimal values and then converted to the
+  *          physical domain. Frames of an unknown (zero) object ID carry no object and are skipped.
+  * @param index The index of the frame in the Rx buffers.
   * @param canData The data contained in the CAN frame.
-  * @param prefusedObject The prefused object to be filled.
   * @return Void.
   */
-static void GetRearRadarObject(const u8_t frameReceived, const u8_t* canData, BaseObject_t* prefusedObject);
+static void DecodeRearRadarObject(const u8_t index, const u8_t* canData);
 
 /***************************** Static Variables ******************************/
 
@@ -60,6 +57,7 @@ static void GetRearRadarObject(const u8_t frameReceived, const u8_t* canData, Ba
 static Sensor_t sensorList[NUM_SENSORS] = 
 {
     {
+        /* .id = */ 0u,
         /* .type = */ RADAR,  /* Front Left */
         /* .tf = */
         {
@@ -74,10 +72,11 @@ static Sensor_t sensorList[NUM_SENSORS] =
         {
             /* .index = */ 0u,
             /* .length = */ 12u,
-            /* .GetObject = */ GetFrontRadarObject,
+            /* .DecodeObject = */ DecodeFrontRadarObject,
         },
     },
     {
+        /* .id = */ 1u,
         /* .type = */ RADAR,  /* Front Right */
         /* .tf = */
         {
@@ -92,10 +91,11 @@ static Sensor_t sensorList[NUM_SENSORS] =
         {
             /* .index = */ 12u,
             /* .length = */ 12u,
-            /* .GetObject = */ GetFrontRadarObject,
+            /* .DecodeObject = */ DecodeFrontRadarObject,
         },
     },
     {
+        /* .id = */ 2u,
         /* .type = */ RADAR,  /* Rear Right */
         /* .tf = */
         {
@@ -110,10 +110,11 @@ static Sensor_t sensorList[NUM_SENSORS] =
         {
             /* .index = */ 0u,
             /* .length = */ 0u,
-            /* .GetObject = */ GetRearRadarObject,
+            /* .DecodeObject = */ DecodeRearRadarObject,
         },
     },
     {
+        /* .id = */ 3u,
         /* .type = */ RADAR,  /* Rear Left */
         /* .tf = */
         {
@@ -128,50 +129,38 @@ static Sensor_t sensorList[NUM_SENSORS] =
         {
             /* .index = */ 0u,
             /* .length = */ 0u,
-            /* .GetObject = */ GetRearRadarObject,
+            /* .DecodeObject = */ DecodeRearRadarObject,
         },
     },
 };
 
 /***************************** Static Functions ******************************/
 
-void GetFrontRadarObject(const u8_t frameReceived, const u8_t* canData, BaseObject_t* prefusedObject)
+void DecodeFrontRadarObject(const u8_t index, const u8_t* canData)
 {
-    if (frameReceived)
-    {
-        prefusedObject->valid = (RX_FRONT_OBJECT_ID_DEC2PHYS(GET_RX_ID(canData)) == 0u) ? FALSE : TRUE;
-        prefusedObject->posX = RX_FRONT_OBJECT_DISTANCE_X_DEC2PHYS(GET_RX_DISTANCE_X(canData));
-        prefusedObject->posY = RX_FRONT_OBJECT_DISTANCE_Y_DEC2PHYS(GET_RX_DISTANCE_Y(canData));
-        prefusedObject->velX = RX_FRONT_OBJECT_VELOCITY_X_DEC2PHYS(GET_RX_VELOCITY_X(canData));
-        prefusedObject->velY = RX_FRONT_OBJECT_VELOCITY_Y_DEC2PHYS(GET_RX_VELOCITY_Y(canData));
-    }
-    else
+    u8_t id = RX_FRONT_OBJECT_ID_DEC2PHYS(GET_RX_ID(canData));
+
+    if (id != 0u)
     {
-        prefusedObject->valid = FALSE;
-        prefusedObject->posX = RX_FRONT_OBJECT_DISTANCE_X_UNKNOWN;
-        prefusedObject->posY = RX_FRONT_OBJECT_DISTANCE_Y_UNKNOWN;
-        prefusedObject->velX = RX_FRONT_OBJECT_VELOCITY_X_UNKNOWN;
-        prefusedObject->velY = RX_FRONT_OBJECT_VELOCITY_Y_UNKNOWN;
+        AddInputObject(index, id,
+            RX_FRONT_OBJECT_DISTANCE_X_DEC2PHYS(GET_RX_DISTANCE_X(canData)),
+            RX_FRONT_OBJECT_DISTANCE_Y_DEC2PHYS(GET_RX_DISTANCE_Y(canData)),
+            RX_FRONT_OBJECT_VELOCITY_X_DEC2PHYS(GET_RX_VELOCITY_X(canData)),
+            RX_FRONT_OBJECT_VELOCITY_Y_DEC2PHYS(GET_RX_VELOCITY_Y(canData)));
     }
 }
 
-void GetRearRadarObject(const u8_t frameReceived, const u8_t* canData, BaseObject_t* prefusedObject)
+void DecodeRearRadarObject(const u8_t index, const u8_t* canData)
 {
-    if (frameReceived)
-    {
-        prefusedObject->valid = (RX_REAR_OBJECT_ID_DEC2PHYS(GET_RX_ID(canData)) == 0u) ? FALSE : TRUE;
-        prefusedObject->posX = RX_REAR_OBJECT_DISTANCE_X_DEC2PHYS(GET_RX_DISTANCE_X(canData));
-        prefusedObject->posY = RX_REAR_OBJECT_DISTANCE_Y_DEC2PHYS(GET_RX_DISTANCE_Y(canData));
-        prefusedObject->velX = RX_REAR_OBJECT_VELOCITY_X_DEC2PHYS(GET_RX_VELOCITY_X(canData));
-        prefusedObject->velY = RX_REAR_OBJECT_VELOCITY_Y_DEC2PHYS(GET_RX_VELOCITY_Y(canData));
-    }
-    else
+    u8_t id = RX_REAR_OBJECT_ID_DEC2PHYS(GET_RX_ID(canData));
+
+    if (id != 0u)
     {
-        prefusedObject->valid = FALSE;
-        prefusedObject->posX = RX_REAR_OBJECT_DISTANCE_X_UNKNOWN;
-        prefusedObject->posY = RX_REAR_OBJECT_DISTANCE_Y_UNKNOWN;
-        prefusedObject->velX = RX_REAR_OBJECT_VELOCITY_X_UNKNOWN;
-        prefusedObject->velY = RX_REAR_OBJECT_VELOCITY_Y_UNKNOWN;
+        AddInputObject(index, id,
+            RX_REAR_OBJECT_DISTANCE_X_DEC2PHYS(GET_RX_DISTANCE_X(canData)),
+            RX_REAR_OBJECT_DISTANCE_Y_DEC2PHYS(GET_RX_DISTANCE_Y(canData)),
+            RX_REAR_OBJECT_VELOCITY_X_DEC2PHYS(GET_RX_VELOCITY_X(canData)),
+            RX_REAR_OBJECT_VELOCITY_Y_DEC2PHYS(GET_RX_VELOCITY_Y(canData)));
     }
 }
 
@@ -0,0 +1,471 @@
+/*
+ * Copyright (C) 2016 Dimitris Geromichalos
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+ /**
+  * Compares the memory traffic of the per-cycle loops (track management and building the gating lanes)
+  * over the interleaved layout of the fused objects (`FusedObject_t` records) and the hot/cold store.
+  * For each loop, the cache lines touched per pass are counted from the addresses of the fields it reads,
+  * the L1 read misses are counted by the hardware where perf events are available, or else by a model of the L1
+  * fed with the same addresses, and the time per pass is measured over many copies of the objects,
+  * so that each pass starts with cold caches.
+  * The model has no prefetcher, so that it counts the lines that are fetched rather than the misses that stall:
+  * on a host, fewer misses do not make a loop faster when the lines of the interleaved layout are prefetched anyway.
+  */
+
+/******************************** Inclusions *********************************/
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "algorithm_types.h"
+#include "tracking.h"
+#include "fused_object_store.h"
+
+/***************************** Macro Definitions *****************************/
+
+/** The number of copies of the objects (several MB in total, more than the caches). */
+#define NUM_COPIES (1024u)
+
+/** The number of passes over all the copies per repeat. */
+#define NUM_PASSES (20u)
+
+/** The number of repeats of each measurement (the best one is reported, to filter out the noise of the host). */
+#define NUM_REPEATS (7u)
+
+/** The max number of distinct cache lines recorded for a single pass. */
+#define MAX_TOUCHED_LINES (1024u)
+
+/** The L1 data cache of the model (32 KiB, 8-way set associative, least recently used replacement). */
+#define L1_WAYS (8u)
+#define L1_SETS ((32u * 1024u) / (L1_WAYS * CACHE_LINE_SIZE))
+
+/** The number of passes over all the copies that the model is fed with (the first one warms it up). */
+#define NUM_MODEL_PASSES (2u)
+
+/****************************** Type Definitions *****************************/
+
+/** A loop over the objects of a single copy, in one of the layouts. */
+typedef real_t (*Loop_t)(const u32_t copy);
+
+/** A visitor of the memory range of a field that a loop reads. */
+typedef void (*Visitor_t)(const void* address, const u32_t size);
+
+/***************************** Static Variables ******************************/
+
+static FusedObject_t interleavedLists[NUM_COPIES][NUM_FUSED_OBJ];
+static FusedObjectStore_t stores[NUM_COPIES];
+
+static uintptr_t touchedLines[MAX_TOUCHED_LINES];
+static u32_t numTouchedLines;
+
+/** The lines held by each set of the L1 model, the most recently used first, and the misses it counted. */
+static uintptr_t modelLines[L1_SETS][L1_WAYS];
+static u32_t modelMisses;
+
+/** Accumulates results so that the compiler cannot drop the measured loops. */
+static volatile real_t sink;
+
+#if defined(__linux__)
+static int missCounter = -1;
+#endif
+
+/***************************** Static Functions ******************************/
+
+static f64_t GetTime(void)
+{
+    struct timespec ts;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ((f64_t)ts.tv_sec + ((f64_t)ts.tv_nsec * 1e-9));
+}
+
+static void OpenMissCounter(void)
+{
+#if defined(__linux__)
+    struct perf_event_attr attr;
+
+    (void)memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HW_CACHE;
+    attr.config = PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+
+    missCounter = (int)syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+#endif
+}
+
+static void StartMissCounter(void)
+{
+#if defined(__linux__)
+    if (missCounter >= 0)
+    {
+        (void)ioctl(missCounter, PERF_EVENT_IOC_RESET, 0);
+        (void)ioctl(missCounter, PERF_EVENT_IOC_ENABLE, 0);
+    }
+#endif
+}
+
+/** Returns the number of misses since the counter was started, or -1 if there is no counter. */
+static f64_t StopMissCounter(void)
+{
+    f64_t misses = -1.;
+#if defined(__linux__)
+    long long count;
+
+    if (missCounter >= 0)
+    {
+        (void)ioctl(missCounter, PERF_EVENT_IOC_DISABLE, 0);
+
+        if (read(missCounter, &count, sizeof(count)) == (ssize_t)sizeof(count))
+        {
+            misses = (f64_t)count;
+        }
+    }
+#endif
+    return misses;
+}
+
+static void TouchRange(const void* address, const u32_t size)
+{
+    u32_t i;
+    uintptr_t line;
+    uintptr_t lastLine = ((uintptr_t)address + size - 1u) / CACHE_LINE_SIZE;
+
+    for (line = (uintptr_t)address / CACHE_LINE_SIZE; line <= lastLine; line++)
+    {
+        for (i = 0u; (i < numTouchedLines) && (touchedLines[i] != line); i++)
+        {
+        }
+
+        if ((i == numTouchedLines) && (numTouchedLines < MAX_TOUCHED_LINES))
+        {
+            touchedLines[numTouchedLines] = line;
+            numTouchedLines++;
+        }
+    }
+}
+
+/** Reads the lines of a range through the L1 model, counting a miss for each line that it does not hold. */
+static void ReadModelRange(const void* address, const u32_t size)
+{
+    u32_t way;
+    uintptr_t line, set;
+    uintptr_t lastLine = ((uintptr_t)address + size - 1u) / CACHE_LINE_SIZE;
+
+    for (line = (uintptr_t)address / CACHE_LINE_SIZE; line <= lastLine; line++)
+    {
+        set = line % L1_SETS;
+
+        for (way = 0u; (way < (L1_WAYS - 1u)) && (modelLines[set][way] != line); way++)
+        {
+        }
+
+        if (modelLines[set][way] != line)
+        {
+            modelMisses++;
+        }
+
+        /* The line becomes the most recently used, the least recently used one being evicted on a miss. */
+        for (; way > 0u; way--)
+        {
+            modelLines[set][way] = modelLines[set][way - 1u];
+        }
+
+        modelLines[set][0] = line;
+    }
+}
+
+static void Initialize(void)
+{
+    u32_t copy;
+    u8_t i, j;
+    Plot_t plot;
+    FusedObject_t* fusedObject;
+
+    (void)memset(&plot, 0, sizeof(Plot_t));
+
+    for (copy = 0u; copy < NUM_COPIES; copy++)
+    {
+        ResetFusedObjectStore(&stores[copy]);
+
+        for (i = 0u; i < NUM_FUSED_OBJ; i++)
+        {
+            fusedObject = &interleavedLists[copy][i];
+            (void)memset(fusedObject, 0, sizeof(FusedObject_t));
+
+            for (j = 0u; j < KALMAN_STATES; j++)
+            {
+                plot.Z[j] = (real_t)(i + j);
+                plot.R[(KALMAN_STATES * j) + j] = 0.5f + (0.1f * j);
+            }
+
+            fusedObject->id = i + 1u;
+            fusedObject->lifetimeCounter = 10u;
+            fusedObject->lostCounter = i % 2u;
+            fusedObject->priority = (real_t)i;
+            fusedObject->seenThisCycle[i % NUM_SENSORS] = 1u;
+            InitializeTrack(&fusedObject->track, &plot);
+
+            SetFusedObject(&stores[copy], i, fusedObject);
+        }
+    }
+}
+
+/* Track management reads the IDs, the means, the priorities, the lost counters and the seen flags. */
+
+static real_t ManageInterleaved(const u32_t copy)
+{
+    u8_t i, j;
+    real_t sum = 0.f;
+    const FusedObject_t* fusedObject;
+
+    for (i = 0u; i < NUM_FUSED_OBJ; i++)
+    {
+        fusedObject = &interleavedLists[copy][i];
+
+        if (fusedObject->id != INVALID_ID)
+        {
+            sum += fusedObject->track.X[STATE_X] + fusedObject->track.X[STATE_Y] +
+                   fusedObject->track.X[STATE_VX] + fusedObject->track.X[STATE_VY] +
+                   fusedObject->priority + fusedObject->lostCounter;
+
+            for (j = 0u; j < NUM_SENSORS; j++)
+            {
+                sum += fusedObject->seenThisCycle[j];
+            }
+        }
+    }
+
+    return sum;
+}
+
+static real_t ManageHot(const u32_t copy)
+{
+    u8_t i, j;
+    real_t sum = 0.f;
+    const FusedObjectHot_t* hot;
+
+    for (i = 0u; i < NUM_FUSED_OBJ; i++)
+    {
+        hot = &stores[copy].hot[i];
+
+        if (hot->id != INVALID_ID)
+        {
+            sum += hot->X[STATE_X] + hot->X[STATE_Y] + hot->X[STATE_VX] + hot->X[STATE_VY] +
+                   hot->priority + hot->lostCounter;
+
+            for (j = 0u; j < NUM_SENSORS; j++)
+            {
+                sum += hot->seenThisCycle[j];
+            }
+        }
+    }
+
+    return sum;
+}
+
+/* Building the gating lanes reads the IDs, the means and the variances (from the covariance factors of a track). */
+
+static real_t GatingInterleaved(const u32_t copy)
+{
+    u8_t i, j;
+    real_t sum = 0.f;
+    const FusedObject_t* fusedObject;
+
+    for (i = 0u; i < NUM_FUSED_OBJ; i++)
+    {
+        fusedObject = &interleavedLists[copy][i];
+
+        if (fusedObject->id != INVALID_ID)
+        {
+            for (j = 0u; j < KALMAN_STATES; j++)
+            {
+                sum += fusedObject->track.X[j] + GetTrackVariance(&fusedObject->track, j);
+            }
+        }
+    }
+
+    return sum;
+}
+
+static real_t GatingHot(const u32_t copy)
+{
+    u8_t i, j;
+    real_t sum = 0.f;
+    const FusedObjectHot_t* hot;
+
+    for (i = 0u; i < NUM_FUSED_OBJ; i++)
+    {
+        hot = &stores[copy].hot[i];
+
+        if (hot->id != INVALID_ID)
+        {
+            for (j = 0u; j < KALMAN_STATES; j++)
+            {
+                sum += hot->X[j] + hot->variance[j];
+            }
+        }
+    }
+
+    return sum;
+}
+
+/** Visits the fields that a loop reads over the objects of a copy, in the order it reads them. */
+static void VisitLoopFields(const Loop_t loop, const u32_t copy, const Visitor_t visit)
+{
+    u8_t i;
+    const FusedObject_t* fusedObject;
+    const FusedObjectHot_t* hot;
+
+    for (i = 0u; i < NUM_FUSED_OBJ; i++)
+    {
+        fusedObject = &interleavedLists[copy][i];
+        hot = &stores[copy].hot[i];
+
+        if (loop == ManageInterleaved)
+        {
+            visit(&fusedObject->id, sizeof(fusedObject->id));
+            visit(fusedObject->track.X, sizeof(KalmanX_t));
+            visit(&fusedObject->priority, sizeof(fusedObject->priority));
+            visit(&fusedObject->lostCounter, sizeof(fusedObject->lostCounter));
+            visit(fusedObject->seenThisCycle, sizeof(fusedObject->seenThisCycle));
+        }
+        else if (loop == GatingInterleaved)
+        {
+            /* The variances are composed from the covariance factors, which span the rest of the track. */
+            visit(&fusedObject->id, sizeof(fusedObject->id));
+            visit(&fusedObject->track, sizeof(Track_t));
+        }
+        else if (loop == ManageHot)
+        {
+            visit(&hot->id, sizeof(hot->id));
+            visit(hot->X, sizeof(KalmanX_t));
+            visit(&hot->priority, sizeof(hot->priority));
+            visit(&hot->lostCounter, sizeof(hot->lostCounter));
+            visit(hot->seenThisCycle, sizeof(hot->seenThisCycle));
+        }
+        else
+        {
+            visit(&hot->id, sizeof(hot->id));
+            visit(hot->X, sizeof(KalmanX_t));
+            visit(hot->variance, sizeof(KalmanPv_t));
+        }
+    }
+}
+
+/** Counts the distinct cache lines of the fields that each loop reads, for the first copy. */
+static u32_t CountTouchedLines(const Loop_t loop)
+{
+    numTouchedLines = 0u;
+
+    VisitLoopFields(loop, 0u, TouchRange);
+
+    return numTouchedLines;
+}
+
+/** Counts the L1 misses per pass of the model, fed with the passes of a loop over all the copies (after a warm-up pass). */
+static f64_t CountModelMisses(const Loop_t loop)
+{
+    u32_t n, copy;
+
+    (void)memset(modelLines, 0, sizeof(modelLines));
+
+    for (n = 0u; n < NUM_MODEL_PASSES; n++)
+    {
+        modelMisses = 0u;
+
+        for (copy = 0u; copy < NUM_COPIES; copy++)
+        {
+            VisitLoopFields(loop, copy, ReadModelRange);
+        }
+    }
+
+    return ((f64_t)modelMisses / NUM_COPIES);
+}
+
+static void Measure(const char* name, const Loop_t loop)
+{
+    u32_t r, n, copy;
+    f64_t start, time, count;
+    f64_t elapsed = -1., misses = -1.;
+    real_t sum = 0.f;
+
+    for (r = 0u; r < NUM_REPEATS; r++)
+    {
+        StartMissCounter();
+        start = GetTime();
+
+        for (n = 0u; n < NUM_PASSES; n++)
+        {
+            for (copy = 0u; copy < NUM_COPIES; copy++)
+            {
+                sum += loop(copy);
+            }
+        }
+
+        time = GetTime() - start;
+        count = StopMissCounter();
+
+        elapsed = ((elapsed < 0.) || (time < elapsed)) ? time : elapsed;
+        misses = ((misses < 0.) || (count < misses)) ? count : misses;
+    }
+
+    sink += sum;
+
+    printf("  %-20s %4u lines/pass", name, (unsigned int)CountTouchedLines(loop));
+
+    if (misses >= 0.)
+    {
+        printf(", %7.1f L1 misses/pass (perf)", misses / (NUM_PASSES * NUM_COPIES));
+    }
+    else
+    {
+        printf(", %7.1f L1 misses/pass (model)", CountModelMisses(loop));
+    }
+
+    printf(", %7.1f ns/pass\n", (elapsed * 1e9) / (NUM_PASSES * NUM_COPIES));
+}
+
+/***************************** Public Functions ******************************/
+
+int main(void)
+{
+    Initialize();
+    OpenMissCounter();
+
+    printf("Hot/cold split (%u objects, hot record %u bytes, track %u bytes):\n",
+        (unsigned int)NUM_FUSED_OBJ, (unsigned int)sizeof(FusedObjectHot_t), (unsigned int)sizeof(Track_t));
+
+    Measure("manage interleaved", ManageInterleaved);
+    Measure("manage hot", ManageHot);
+    Measure("gating interleaved", GatingInterleaved);
+    Measure("gating hot", GatingHot);
+
+    return 0;
+}
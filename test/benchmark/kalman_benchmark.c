@@ -0,0 +1,166 @@
+/*
+ * Copyright (C) 2016 Dimitris Geromichalos
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+ /**
+  * Measures the time per call of the UD Kalman kernels.
+  * Build it with and without `KALMAN_GENERIC_KERNELS` (see `make benchmark`)
+  * to compare the generic loops with the kernels specialized for the state dimension.
+  */
+
+/******************************** Inclusions *********************************/
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "algorithm_types.h"
+#include "kalman_utils.h"
+
+/***************************** Macro Definitions *****************************/
+
+#define NUM_ITERATIONS (1000000u)
+
+/***************************** Static Variables ******************************/
+
+static KalmanF_t F;
+static KalmanP_t P;
+static KalmanQu_t Qu;
+static KalmanQd_t Qd;
+static KalmanPu_t U;
+static KalmanPd_t D;
+static KalmanPu_t U0;
+static KalmanPd_t D0;
+static KalmanX_t X;
+static KalmanH_t H;
+static KalmanZ_t Z;
+static real_t R[KALMAN_STATES];
+static KalmanWorkspace_t workspace;
+
+/** Accumulates results so that the compiler cannot drop the measured calls. */
+static volatile real_t sink;
+
+/***************************** Static Functions ******************************/
+
+static f64_t GetTime(void)
+{
+    struct timespec ts;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ((f64_t)ts.tv_sec + ((f64_t)ts.tv_nsec * 1e-9));
+}
+
+static void Initialize(void)
+{
+    u8_t i;
+
+    (void)memset(F, 0, sizeof(KalmanF_t));
+    (void)memset(P, 0, sizeof(KalmanP_t));
+
+    for (i = 0u; i < KALMAN_STATES; i++)
+    {
+        F[(KALMAN_STATES * i) + i] = 1.f;
+        P[(KALMAN_STATES * i) + i] = 0.5f + i;
+        X[i] = 1.f * i;
+        Z[i] = X[i] + 0.1f;
+        R[i] = 0.5f;
+    }
+
+    F[(KALMAN_STATES * STATE_X) + STATE_VX] = 0.04f;
+    F[(KALMAN_STATES * STATE_Y) + STATE_VY] = 0.04f;
+
+    DecomposeUD(P, Qu, Qd);
+    DecomposeUD(P, U0, D0);
+}
+
+static void ResetFactors(void)
+{
+    (void)memcpy(U, U0, sizeof(KalmanPu_t));
+    (void)memcpy(D, D0, sizeof(KalmanPd_t));
+}
+
+static void Report(const char* name, const f64_t start)
+{
+    printf("%-20s %8.2f ns/call\n", name, ((GetTime() - start) * 1e9) / NUM_ITERATIONS);
+}
+
+/***************************** Public Functions ******************************/
+
+int main(void)
+{
+    u32_t n;
+    f64_t start;
+
+#ifdef KALMAN_GENERIC_KERNELS
+    printf("Generic kernels:\n");
+#else
+    printf("Specialized kernels:\n");
+#endif
+
+    Initialize();
+    ResetFactors();
+
+    start = GetTime();
+    for (n = 0u; n < NUM_ITERATIONS; n++)
+    {
+        P[0] = 0.5f + ((real_t)(n & 7u) * 1e-3f);
+        ComposeUD(U, D, P);
+        sink += P[1];
+    }
+    Report("ComposeUD", start);
+
+    start = GetTime();
+    for (n = 0u; n < NUM_ITERATIONS; n++)
+    {
+        DecomposeUD(P, U, D);
+        sink += U[1];
+    }
+    Report("DecomposeUD", start);
+
+    start = GetTime();
+    for (n = 0u; n < NUM_ITERATIONS; n++)
+    {
+        ResetFactors();
+        EstimateCovariance(F, Qu, Qd, U, D, &workspace);
+        sink += D[0];
+    }
+    Report("EstimateCovariance", start);
+
+    start = GetTime();
+    for (n = 0u; n < NUM_ITERATIONS; n++)
+    {
+        (void)memset(H, 0, sizeof(KalmanH_t));
+        H[n % KALMAN_STATES] = 1.f;
+
+        ResetFactors();
+        FuseState(0.1f, 0.5f, H, X, U, D);
+        sink += X[0];
+    }
+    Report("FuseState", start);
+
+    start = GetTime();
+    for (n = 0u; n < NUM_ITERATIONS; n++)
+    {
+        ResetFactors();
+        FuseUnitStates(Z, R, 1.f, X, U, D);
+        sink += X[0];
+    }
+    Report("FuseUnitStates", start);
+
+    return 0;
+}
@@ -0,0 +1,322 @@
+/*
+ * Copyright (C) 2016 Dimitris Geromichalos
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+ /**
+  * Measures the speed and the accuracy of the numeric precision backends.
+  * Build it once per `FUSION_PRECISION` (see `make benchmark`).
+  *
+  * 1. Pipeline: A deterministic scenario (targets with noisy plots, dropouts and duplicates)
+  *    is replayed through the algorithm. The time per cycle and the RMS error
+  *    of the fused objects against the ground truth are reported.
+  *    The time of the association and its clusters and hypotheses (JPDA) are reported for each association mode.
+  *    The greedy mode is replayed again with the sensor object IDs reported, so that the association hints are followed.
+  * 2. Axis kernel: The experimental Q16.16 variant of the decoupled axis filter (see `q16_axis.h`) is replayed
+  *    next to the real (selected precision) one, which is used as the reference.
+  *    The plots are converted before and the errors are computed after the timed loops, so that only the kernels are timed.
+  */
+
+/******************************** Inclusions *********************************/
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "base_types.h"
+#include "platform_params.h"
+#include "constants.h"
+#include "config.h"
+#include "algorithm_interface.h"
+#include "kalman_utils.h"
+
+#include "q16_axis.h"
+
+/***************************** Macro Definitions *****************************/
+
+#define NUM_TARGETS (10u)
+#define NUM_CYCLES  (20000u)
+#define NUM_STEPS   (1000000u)
+
+#define MAX_MATCH_DIST (5.f)
+
+#define DT          (0.04f)
+#define VAR_Q_POS   (2.25f)
+#define VAR_Q_VEL   (9.f)
+#define VAR_R_POS   (0.09f)
+#define VAR_R_VEL   (0.25f)
+
+/***************************** Static Variables ******************************/
+
+static u32_t seed = 12345u;
+
+static f32_t targetX[NUM_TARGETS];
+static f32_t targetY[NUM_TARGETS];
+static f32_t targetVX[NUM_TARGETS];
+static f32_t targetVY[NUM_TARGETS];
+
+/***************************** Static Functions ******************************/
+
+static f64_t GetTime(void)
+{
+    struct timespec ts;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ((f64_t)ts.tv_sec + ((f64_t)ts.tv_nsec * 1e-9));
+}
+
+/** A uniform random number in [-0.5, 0.5] (deterministic across builds). */
+static f32_t GetNoise(void)
+{
+    seed = (seed * 1103515245u) + 12345u;
+
+    return ((f32_t)((seed >> 8u) & 0xFFFFu) / 65535.f) - 0.5f;
+}
+
+static void MoveTargets(void)
+{
+    u8_t k;
+
+    for (k = 0u; k < NUM_TARGETS; k++)
+    {
+        targetX[k] += targetVX[k] * DT;
+        targetY[k] += targetVY[k] * DT;
+
+        if (targetX[k] > 100.f)
+        {
+            targetX[k] = 2.f;
+        }
+        else if (targetX[k] < 0.f)
+        {
+            targetX[k] = 90.f;
+        }
+    }
+}
+
+static void RunPipeline(const u8_t associationMode, const u8_t sensorObjectIds)
+{
+    BaseObject_t inputObjectList[NUM_PREFUSED_OBJ];
+    BaseObject_t outputObjectList[NUM_FUSED_OBJ];
+    AssociationStats_t stats;
+    f64_t associationTime = 0., clusters = 0., hypotheses = 0.;
+    u32_t fallbacks = 0u;
+    u32_t c, matches = 0u;
+    u8_t i, k, slot, best;
+    f64_t start, elapsed = 0.;
+    f64_t errorPos = 0., errorVel = 0.;
+    f32_t dist, bestDist, dvx, dvy;
+
+    for (k = 0u; k < NUM_TARGETS; k++)
+    {
+        targetX[k] = 5.f + (8.f * k);
+        targetY[k] = -10.f + (2.5f * k);
+        targetVX[k] = -3.f + k;
+        targetVY[k] = 0.5f - (0.1f * k);
+    }
+
+    ASSOCIATION_MODE = associationMode;
+
+    (void)InitializeAlgorithm(NULL);
+
+    for (c = 0u; c < NUM_CYCLES; c++)
+    {
+        (void)memset(inputObjectList, 0, sizeof(inputObjectList));
+
+        MoveTargets();
+
+        for (k = 0u; k < NUM_TARGETS; k++)
+        {
+            slot = (k < 5u) ? k : (12u + (k - 5u));
+
+            if (GetNoise() < -0.4f)
+            {
+                continue;
+            }
+
+            inputObjectList[slot].valid = 1u;
+            inputObjectList[slot].id = sensorObjectIds ? (k + 1u) : 0u;
+            inputObjectList[slot].posX = targetX[k] + (GetNoise() * 0.6f);
+            inputObjectList[slot].posY = targetY[k] + (GetNoise() * 0.6f);
+            inputObjectList[slot].velX = targetVX[k] + GetNoise();
+            inputObjectList[slot].velY = targetVY[k] + GetNoise();
+
+            if ((k % 3u) == 0u)
+            {
+                i = (k < 5u) ? (17u + (k % 2u)) : (5u + (k % 2u));
+                inputObjectList[i] = inputObjectList[slot];
+                inputObjectList[i].posX += 0.2f;
+                inputObjectList[i].id = sensorObjectIds ? (NUM_TARGETS + k + 1u) : 0u;
+            }
+        }
+
+        start = GetTime();
+        RunAlgorithm(inputObjectList, outputObjectList, DT);
+        elapsed += GetTime() - start;
+
+        GetAlgorithmStats(&stats);
+
+        associationTime += stats.time;
+        clusters += stats.clusters;
+        hypotheses += stats.hypotheses;
+        fallbacks += stats.fallbacks;
+
+        for (i = 0u; i < NUM_FUSED_OBJ; i++)
+        {
+            if (!outputObjectList[i].valid)
+            {
+                continue;
+            }
+
+            best = 0u;
+            bestDist = MAX_MATCH_DIST;
+
+            for (k = 0u; k < NUM_TARGETS; k++)
+            {
+                dist = ((outputObjectList[i].posX - targetX[k]) * (outputObjectList[i].posX - targetX[k])) +
+                       ((outputObjectList[i].posY - targetY[k]) * (outputObjectList[i].posY - targetY[k]));
+
+                if (dist < bestDist)
+                {
+                    bestDist = dist;
+                    best = k;
+                }
+            }
+
+            if (bestDist < MAX_MATCH_DIST)
+            {
+                dvx = outputObjectList[i].velX - targetVX[best];
+                dvy = outputObjectList[i].velY - targetVY[best];
+
+                errorPos += bestDist;
+                errorVel += (dvx * dvx) + (dvy * dvy);
+                matches++;
+            }
+        }
+    }
+
+    printf("  pipeline:   %8.2f us/cycle, RMS error pos %.5f m, vel %.5f m/s (%u matches)\n",
+        (elapsed * 1e6) / NUM_CYCLES, sqrt(errorPos / matches), sqrt(errorVel / matches), matches);
+    printf("    update:   %8.2f us/cycle, %.2f clusters/cycle, %.2f hypotheses/cycle, %u fallbacks\n",
+        (associationTime * 1e6) / NUM_CYCLES, clusters / NUM_CYCLES, hypotheses / NUM_CYCLES, fallbacks);
+}
+
+static void RunAxisKernels(void)
+{
+    u32_t n;
+    f64_t start, elapsedReal, elapsedQ16;
+    f64_t errorReal = 0., errorQ16 = 0., maxDeviation = 0., deviation;
+    real_t truePos = 0.f, trueVel = 5.f;
+    real_t pos = 0.f, vel = 5.f;
+    real_t Z;
+    q16_t posQ16, velQ16, dtQ16, varPosQ16, varVelQ16;
+    KalmanAxisP_t P = { VAR_R_POS, 0.f, VAR_R_VEL };
+    KalmanAxisQ_t Q;
+    q16_t PQ16[GET_SIZE_UPPER(AXIS_STATES)];
+    q16_t QQ16[GET_SIZE_UPPER(AXIS_STATES)];
+    static real_t plotPos[NUM_STEPS];
+    static real_t plotVel[NUM_STEPS];
+    static real_t truth[NUM_STEPS];
+    static real_t outputPos[NUM_STEPS];
+    static q16_t plotPosQ16[NUM_STEPS];
+    static q16_t plotVelQ16[NUM_STEPS];
+    static q16_t outputPosQ16[NUM_STEPS];
+
+    Q[GET_UPPER_INDEX(0u, 0u, AXIS_STATES)] = (VAR_Q_POS * DT) + ((VAR_Q_VEL * DT * DT * DT) / 3.f);
+    Q[GET_UPPER_INDEX(0u, 1u, AXIS_STATES)] = (VAR_Q_VEL * DT * DT) / 2.f;
+    Q[GET_UPPER_INDEX(1u, 1u, AXIS_STATES)] = VAR_Q_VEL * DT;
+
+    for (n = 0u; n < GET_SIZE_UPPER(AXIS_STATES); n++)
+    {
+        PQ16[n] = Q16_FROM_REAL(P[n]);
+        QQ16[n] = Q16_FROM_REAL(Q[n]);
+    }
+
+    posQ16 = Q16_FROM_REAL(pos);
+    velQ16 = Q16_FROM_REAL(vel);
+    dtQ16 = Q16_FROM_REAL(DT);
+    varPosQ16 = Q16_FROM_REAL(VAR_R_POS);
+    varVelQ16 = Q16_FROM_REAL(VAR_R_VEL);
+
+    for (n = 0u; n < NUM_STEPS; n++)
+    {
+        trueVel = ((n / 2000u) % 2u) ? -5.f : 5.f;
+        truePos += trueVel * DT;
+
+        truth[n] = truePos;
+        plotPos[n] = truePos + GetNoise();
+        plotVel[n] = trueVel + GetNoise();
+
+        plotPosQ16[n] = Q16_FROM_REAL(plotPos[n]);
+        plotVelQ16[n] = Q16_FROM_REAL(plotVel[n]);
+    }
+
+    start = GetTime();
+    for (n = 0u; n < NUM_STEPS; n++)
+    {
+        PredictAxis(DT, Q, &pos, &vel, P);
+        FuseAxis(plotPos[n] - pos, VAR_R_POS, 0u, &pos, &vel, P);
+        FuseAxis(plotVel[n] - vel, VAR_R_VEL, 1u, &pos, &vel, P);
+        outputPos[n] = pos;
+    }
+    elapsedReal = GetTime() - start;
+
+    start = GetTime();
+    for (n = 0u; n < NUM_STEPS; n++)
+    {
+        PredictAxisQ16(dtQ16, QQ16, &posQ16, &velQ16, PQ16);
+        FuseAxisQ16(plotPosQ16[n] - posQ16, varPosQ16, 0u, &posQ16, &velQ16, PQ16);
+        FuseAxisQ16(plotVelQ16[n] - velQ16, varVelQ16, 1u, &posQ16, &velQ16, PQ16);
+        outputPosQ16[n] = posQ16;
+    }
+    elapsedQ16 = GetTime() - start;
+
+    for (n = 0u; n < NUM_STEPS; n++)
+    {
+        Z = Q16_TO_REAL(outputPosQ16[n]);
+
+        errorReal += (outputPos[n] - truth[n]) * (outputPos[n] - truth[n]);
+        errorQ16 += (Z - truth[n]) * (Z - truth[n]);
+
+        deviation = fabs(Z - outputPos[n]);
+        maxDeviation = (deviation > maxDeviation) ? deviation : maxDeviation;
+    }
+
+    printf("  axis real:  %8.2f ns/step, RMS error pos %.5f m\n",
+        (elapsedReal * 1e9) / NUM_STEPS, sqrt(errorReal / NUM_STEPS));
+    printf("  axis Q16:   %8.2f ns/step, RMS error pos %.5f m, max deviation from real %.5f m\n",
+        (elapsedQ16 * 1e9) / NUM_STEPS, sqrt(errorQ16 / NUM_STEPS), maxDeviation);
+}
+
+/***************************** Public Functions ******************************/
+
+int main(void)
+{
+#if (FUSION_PRECISION == FUSION_PRECISION_F64)
+    printf("F64 precision:\n");
+#else
+    printf("F32 precision:\n");
+#endif
+
+    RunPipeline(ASSOCIATION_MODE_GREEDY, FALSE);
+    RunPipeline(ASSOCIATION_MODE_GREEDY, TRUE);
+    RunPipeline(ASSOCIATION_MODE_GNN, FALSE);
+    RunPipeline(ASSOCIATION_MODE_JPDA, FALSE);
+
+    RunAxisKernels();
+
+    return 0;
+}
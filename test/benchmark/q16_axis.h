@@ -0,0 +1,120 @@
+/*
+ * Copyright (C) 2016 Dimitris Geromichalos
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef Q16_AXIS_H
+#define Q16_AXIS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+ /**
+  * An experimental Q16.16 fixed-point variant of the decoupled axis filter (`PredictAxis` and `FuseAxis`).
+  * It is not a precision of the fusion core (see `FUSION_PRECISION`): it is only used by the precision benchmark,
+  * which measures its speed and its deviation from the real kernel.
+  */
+
+/******************************** Inclusions *********************************/
+
+#include "common_types.h"
+#include "algorithm_types.h"
+
+/***************************** Macro Definitions *****************************/
+
+/**
+  * @defgroup q16_math The arithmetic of the Q16.16 fixed-point numbers
+  * Conversions from reals are rounded to the nearest fixed-point number.
+  * The products and quotients are computed in 64 bits and truncated back to Q16.16.
+  *
+  * @{
+  */
+#define Q16_SHIFT (16)
+#define Q16_ONE   ((q16_t)1 << Q16_SHIFT)
+
+#define Q16_FROM_REAL(x) ((q16_t)(((x) * (real_t)Q16_ONE) + (((x) >= (real_t)0) ? (real_t)0.5 : (real_t)-0.5)))
+#define Q16_TO_REAL(x)   ((real_t)(x) / (real_t)Q16_ONE)
+#define Q16_MUL(a,b)     ((q16_t)(((s64_t)(a) * (s64_t)(b)) >> Q16_SHIFT))
+#define Q16_DIV(a,b)     ((q16_t)(((s64_t)(a) * Q16_ONE) / (s64_t)(b)))
+/** @} */
+
+/***************************** Type Definitions ******************************/
+
+/** A Q16.16 fixed-point number (16 integer bits, 16 fractional bits). */
+typedef s32_t q16_t;
+
+/***************************** Public Functions ******************************/
+
+/**
+  * @brief Performs the predict step of a decoupled axis filter in Q16.16 fixed-point.
+  * @see `PredictAxis`.
+  * @param dt The time step.
+  * @param inputQ The upper matrix of the noise covariance matrix of the axis.
+  * @param pos The position state of the axis.
+  * @param vel The velocity state of the axis.
+  * @param P The upper matrix of the covariance matrix of the axis.
+  * @return Void.
+  */
+static inline void PredictAxisQ16(const q16_t dt, const q16_t* inputQ, q16_t* pos, q16_t* vel, q16_t* P)
+{
+    q16_t covPosVel = P[GET_UPPER_INDEX(0u, 1u, AXIS_STATES)];
+    q16_t varVel = P[GET_UPPER_INDEX(1u, 1u, AXIS_STATES)];
+
+    P[GET_UPPER_INDEX(0u, 0u, AXIS_STATES)] += Q16_MUL(dt, (2 * covPosVel) + Q16_MUL(dt, varVel)) + inputQ[GET_UPPER_INDEX(0u, 0u, AXIS_STATES)];
+    P[GET_UPPER_INDEX(0u, 1u, AXIS_STATES)] += Q16_MUL(dt, varVel) + inputQ[GET_UPPER_INDEX(0u, 1u, AXIS_STATES)];
+    P[GET_UPPER_INDEX(1u, 1u, AXIS_STATES)] += inputQ[GET_UPPER_INDEX(1u, 1u, AXIS_STATES)];
+
+    *pos += Q16_MUL(dt, *vel);
+}
+
+/**
+  * @brief Fuses a measurement of a state with a decoupled axis filter in Q16.16 fixed-point.
+  * @see `FuseAxis`.
+  * @param innovation The measurement innovation.
+  * @param alpha The noise of the innovation.
+  * @param state The measured state of the axis (0 for pos, 1 for vel).
+  * @param pos The position state of the axis.
+  * @param vel The velocity state of the axis.
+  * @param P The upper matrix of the covariance matrix of the axis.
+  * @return Void.
+  */
+static inline void FuseAxisQ16(const q16_t innovation, const q16_t alpha, const u8_t state, q16_t* pos, q16_t* vel, q16_t* P)
+{
+    u8_t other = 1u - state;
+    q16_t varState = P[GET_UPPER_INDEX(state, state, AXIS_STATES)];
+    q16_t covPosVel = P[GET_UPPER_INDEX(0u, 1u, AXIS_STATES)];
+    q16_t variance = varState + alpha;
+    q16_t gainState = Q16_DIV(varState, variance);
+    q16_t gainOther = Q16_DIV(covPosVel, variance);
+    q16_t gainNoise = Q16_DIV(alpha, variance);
+    q16_t* measured = (state == 0u) ? pos : vel;
+    q16_t* unmeasured = (state == 0u) ? vel : pos;
+
+    *measured += Q16_MUL(gainState, innovation);
+    *unmeasured += Q16_MUL(gainOther, innovation);
+
+    P[GET_UPPER_INDEX(other, other, AXIS_STATES)] -= Q16_MUL(gainOther, covPosVel);
+    P[GET_UPPER_INDEX(0u, 1u, AXIS_STATES)] = Q16_MUL(covPosVel, gainNoise);
+    P[GET_UPPER_INDEX(state, state, AXIS_STATES)] = Q16_MUL(varState, gainNoise);
+}
+
+/*****************************************************************************/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* Q16_AXIS_H */
@@ -0,0 +1,54 @@
+/*
+ * Copyright (C) 2016 Dimitris Geromichalos
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+ /**
+  * Reports the memory used per track by the selected track storage.
+  * Build it once per `TRACK_STORAGE` (see `make benchmark`).
+  */
+
+/******************************** Inclusions *********************************/
+
+#include <stdio.h>
+
+#include "base_types.h"
+#include "platform_params.h"
+#include "algorithm_types.h"
+
+/***************************** Macro Definitions *****************************/
+
+/** Get the number of cache lines that an object of a given size spans at most. */
+#define GET_CACHE_LINES(size) ((((size) + CACHE_LINE_SIZE - 1u) / CACHE_LINE_SIZE) + ((((size) % CACHE_LINE_SIZE) != 0u) ? 1u : 0u))
+
+/***************************** Public Functions ******************************/
+
+int main(void)
+{
+#if (TRACK_STORAGE == TRACK_STORAGE_COMPACT)
+    printf("Compact track storage:\n");
+#else
+    printf("Full track storage:\n");
+#endif
+
+    printf("  track:        %4u bytes, spans up to %u cache lines\n",
+        (unsigned int)sizeof(Track_t), (unsigned int)GET_CACHE_LINES(sizeof(Track_t)));
+    printf("  fused object: %4u bytes\n", (unsigned int)sizeof(FusedObject_t));
+    printf("  fused list:   %4u bytes (%u objects)\n",
+        (unsigned int)(sizeof(FusedObject_t) * NUM_FUSED_OBJ), (unsigned int)NUM_FUSED_OBJ);
+
+    return 0;
+}
@@ -19,19 +19,19 @@
 
 #include "gtest/gtest.h"
 
+#include <string.h>
+
 #include "base_types.h"
+#include "sensor_interface.h"
 
 #include "platform_params.h"
 #include "config.h"
 #include "radar_utils.h"
+#include "fusion.h"
 #include "fusion_utils.h"
+#include "fused_object_store.h"
 #include "tracking.h"
 
-#include "sensor_interface.c"
-#include "kalman_utils.c"
-#include "tracker.c"
-#include "algo.c"
-
 #define FRONT_LEFT (0u)
 #define FRONT_RIGHT (1u)
 #define REAR_RIGHT (2u)
@@ -40,6 +40,9 @@
 namespace
 {
 
+   /* The maximum capacities of the algorithm. */
+   const AlgorithmConfig_t algorithmConfig = { NUM_PREFUSED_OBJ, NUM_FUSED_OBJ, NUM_SENSORS, MAX_ID };
+
    class FusionTest : public testing::Test
    {
    protected:
@@ -56,15 +59,15 @@ namespace
       {
          InitializeSensorInterface(sensorList);
 
-         for (int i = 0; i < NUM_SENSORS; i++)
+         for (u8_t i = 0u; i < NUM_SENSORS; i++)
          {
             sensorList[i].tf.canX = 0.f;  // Set to 0 so no offset is applied
          }
 
          (void)memset(prefusedObjectList, 0, sizeof(PrefusedObject_t) * (u32_t)NUM_PREFUSED_OBJ);
-         (void)memset(fusedObjectList, 0, sizeof(FusedObject_t) * (u32_t)NUM_FUSED_OBJ);
 
-         InitializeFusion();
+         InitializeFusion(&algorithmConfig);
+         ResetFusedObjectStore(&store);
       }
 
       virtual void TearDown()
@@ -73,7 +76,7 @@ namespace
 
       Sensor_t sensorList[NUM_SENSORS];
       PrefusedObject_t prefusedObjectList[NUM_PREFUSED_OBJ];
-      FusedObject_t fusedObjectList[NUM_FUSED_OBJ];
+      FusedObjectStore_t store;
    };
 
    TEST_F(FusionTest, maxPrefusedObjects)
@@ -83,12 +86,11 @@ namespace
          CreatePrefusedObject(&prefusedObjectList[i], &sensorList[REAR_RIGHT], i * (-10.f), -3.f, -10.f, 0.f);
       }
 
-      RunFusion(prefusedObjectList, fusedObjectList);
-      (void)memset(prefusedObjectList, 0, sizeof(PrefusedObject_t) * (u32_t)NUM_PREFUSED_OBJ);
+      RunFusion(prefusedObjectList, (u8_t)NUM_PREFUSED_OBJ, &store, CYCLE_TIME);
 
       for (int i = 0; i < NUM_FUSED_OBJ; i++)
       {
-         EXPECT_NE(fusedObjectList[i].id, 0u);
+         EXPECT_NE(store.hot[i].id, 0u);
       }
    }
    
@@ -97,7 +99,6 @@ namespace
    {
       CreatePrefusedObject(&prefusedObjectList[0], &sensorList[FRONT_LEFT], 4.f, 3.f, 10.f, -0.1f);
 
-      EXPECT_EQ(prefusedObjectList[0].valid, TRUE);
       EXPECT_EQ(prefusedObjectList[0].sensor, &sensorList[FRONT_LEFT]);
       EXPECT_FLOAT_EQ(prefusedObjectList[0].plot.Z[STATE_X], 4.f);
       EXPECT_FLOAT_EQ(prefusedObjectList[0].plot.Z[STATE_Y], 3.f);
@@ -109,12 +110,11 @@ namespace
    // Case 1
    TEST_F(FusionTest, noOperation)
    {
-      RunFusion(prefusedObjectList, fusedObjectList);
-      (void)memset(prefusedObjectList, 0, sizeof(PrefusedObject_t) * (u32_t)NUM_PREFUSED_OBJ);
+      RunFusion(prefusedObjectList, 0u, &store, CYCLE_TIME);
 
       for (int i = 0; i < NUM_FUSED_OBJ; i++)
       {
-         ASSERT_EQ(fusedObjectList[i].id, 0u);
+         ASSERT_EQ(store.hot[i].id, 0u);
       }
    }
    
@@ -123,17 +123,16 @@ namespace
    {
       CreatePrefusedObject(&prefusedObjectList[0], &sensorList[FRONT_LEFT], 4.f, 3.f, 10.f, 0.f);
 
-      RunFusion(prefusedObjectList, fusedObjectList);
-      (void)memset(prefusedObjectList, 0, sizeof(PrefusedObject_t) * (u32_t)NUM_PREFUSED_OBJ);
-
-      EXPECT_EQ(fusedObjectList[0].id, 1u);
-      EXPECT_EQ(fusedObjectList[0].lifetimeCounter, 1u);
-      EXPECT_EQ(fusedObjectList[0].lostCounter, 0u);
-      EXPECT_FLOAT_EQ(fusedObjectList[0].track.X[STATE_X], 4.f);
-      EXPECT_FLOAT_EQ(fusedObjectList[0].track.X[STATE_Y], 3.f);
-      EXPECT_FLOAT_EQ(fusedObjectList[0].track.X[STATE_VX], 10.f);
-      EXPECT_FLOAT_EQ(fusedObjectList[0].track.X[STATE_VY], 0.f);
-      EXPECT_FLOAT_EQ(fusedObjectList[0].priority, 0.f);  // Should not be updated in this cycle
+      RunFusion(prefusedObjectList, 1u, &store, CYCLE_TIME);
+
+      EXPECT_EQ(store.hot[0].id, 1u);
+      EXPECT_EQ(store.cold[0].lifetimeCounter, 1u);
+      EXPECT_EQ(store.hot[0].lostCounter, 0u);
+      EXPECT_FLOAT_EQ(store.cold[0].track.X[STATE_X], 4.f);
+      EXPECT_FLOAT_EQ(store.cold[0].track.X[STATE_Y], 3.f);
+      EXPECT_FLOAT_EQ(store.cold[0].track.X[STATE_VX], 10.f);
+      EXPECT_FLOAT_EQ(store.cold[0].track.X[STATE_VY], 0.f);
+      EXPECT_FLOAT_EQ(store.hot[0].priority, 0.f);  // Should not be updated in this cycle
    }
    
    // Case 5
@@ -141,32 +140,29 @@ namespace
    {
       CreatePrefusedObject(&prefusedObjectList[0], &sensorList[FRONT_LEFT], 4.f, -3.f, -10.f, 1.f);
 
-      RunFusion(prefusedObjectList, fusedObjectList);
-      (void)memset(prefusedObjectList, 0, sizeof(PrefusedObject_t) * (u32_t)NUM_PREFUSED_OBJ);
+      RunFusion(prefusedObjectList, 1u, &store, CYCLE_TIME);
 
-      ASSERT_EQ(fusedObjectList[0].id, 1u);
+      ASSERT_EQ(store.hot[0].id, 1u);
 
-      RunFusion(prefusedObjectList, fusedObjectList);
-      (void)memset(prefusedObjectList, 0, sizeof(PrefusedObject_t) * (u32_t)NUM_PREFUSED_OBJ);
+      RunFusion(prefusedObjectList, 0u, &store, CYCLE_TIME);
 
-      EXPECT_EQ(fusedObjectList[0].id, 1u);
-      EXPECT_EQ(fusedObjectList[0].lifetimeCounter, 2u);
-      EXPECT_EQ(fusedObjectList[0].lostCounter, 1u);
-      EXPECT_FLOAT_EQ(fusedObjectList[0].track.X[STATE_X], 3.6f);
-      EXPECT_FLOAT_EQ(fusedObjectList[0].track.X[STATE_Y], -2.96f);
-      EXPECT_FLOAT_EQ(fusedObjectList[0].track.X[STATE_VX], -10.f);
-      EXPECT_FLOAT_EQ(fusedObjectList[0].track.X[STATE_VY], 1.f);
+      EXPECT_EQ(store.hot[0].id, 1u);
+      EXPECT_EQ(store.cold[0].lifetimeCounter, 2u);
+      EXPECT_EQ(store.hot[0].lostCounter, 1u);
+      EXPECT_FLOAT_EQ(store.cold[0].track.X[STATE_X], 3.6f);
+      EXPECT_FLOAT_EQ(store.cold[0].track.X[STATE_Y], -2.96f);
+      EXPECT_FLOAT_EQ(store.cold[0].track.X[STATE_VX], -10.f);
+      EXPECT_FLOAT_EQ(store.cold[0].track.X[STATE_VY], 1.f);
 
-      RunFusion(prefusedObjectList, fusedObjectList);
-      (void)memset(prefusedObjectList, 0, sizeof(PrefusedObject_t) * (u32_t)NUM_PREFUSED_OBJ);
+      RunFusion(prefusedObjectList, 0u, &store, CYCLE_TIME);
 
-      EXPECT_EQ(fusedObjectList[0].id, 1u);
-      EXPECT_EQ(fusedObjectList[0].lifetimeCounter, 3u);
-      EXPECT_EQ(fusedObjectList[0].lostCounter, 2u);
-      EXPECT_FLOAT_EQ(fusedObjectList[0].track.X[STATE_X], 3.2f);
-      EXPECT_FLOAT_EQ(fusedObjectList[0].track.X[STATE_Y], -2.92f);
-      EXPECT_FLOAT_EQ(fusedObjectList[0].track.X[STATE_VX], -10.f);
-      EXPECT_FLOAT_EQ(fusedObjectList[0].track.X[STATE_VY], 1.f);
+      EXPECT_EQ(store.hot[0].id, 1u);
+      EXPECT_EQ(store.cold[0].lifetimeCounter, 3u);
+      EXPECT_EQ(store.hot[0].lostCounter, 2u);
+      EXPECT_FLOAT_EQ(store.cold[0].track.X[STATE_X], 3.2f);
+      EXPECT_FLOAT_EQ(store.cold[0].track.X[STATE_Y], -2.92f);
+      EXPECT_FLOAT_EQ(store.cold[0].track.X[STATE_VX], -10.f);
+      EXPECT_FLOAT_EQ(store.cold[0].track.X[STATE_VY], 1.f);
    }
    
    // Case 6.1
@@ -174,28 +170,26 @@ namespace
    {
       CreatePrefusedObject(&prefusedObjectList[0], &sensorList[FRONT_LEFT], 4.f, 3.f, 10.f, 0.f);
 
-      RunFusion(prefusedObjectList, fusedObjectList);
-      (void)memset(prefusedObjectList, 0, sizeof(PrefusedObject_t) * (u32_t)NUM_PREFUSED_OBJ);
+      RunFusion(prefusedObjectList, 1u, &store, CYCLE_TIME);
 
-      ASSERT_EQ(fusedObjectList[0].id, 1u);
-      ASSERT_EQ(fusedObjectList[1].id, 0u);
+      ASSERT_EQ(store.hot[0].id, 1u);
+      ASSERT_EQ(store.hot[1].id, 0u);
 
       CreatePrefusedObject(&prefusedObjectList[0], &sensorList[FRONT_LEFT], 4.4f, 3.f, 10.f, 0.f);
 
-      RunFusion(prefusedObjectList, fusedObjectList);
-      (void)memset(prefusedObjectList, 0, sizeof(PrefusedObject_t) * (u32_t)NUM_PREFUSED_OBJ);
+      RunFusion(prefusedObjectList, 1u, &store, CYCLE_TIME);
 
-      EXPECT_EQ(fusedObjectList[0].id, 1u);
-      EXPECT_EQ(fusedObjectList[0].lifetimeCounter, 2u);
-      EXPECT_EQ(fusedObjectList[0].lostCounter, 0u);
-      EXPECT_FLOAT_EQ(fusedObjectList[0].track.X[STATE_X], 4.4f);
-      EXPECT_FLOAT_EQ(fusedObjectList[0].track.X[STATE_Y], 3.f);
-      EXPECT_FLOAT_EQ(fusedObjectList[0].track.X[STATE_VX], 10.f);
-      EXPECT_FLOAT_EQ(fusedObjectList[0].track.X[STATE_VY], 0.f);
+      EXPECT_EQ(store.hot[0].id, 1u);
+      EXPECT_EQ(store.cold[0].lifetimeCounter, 2u);
+      EXPECT_EQ(store.hot[0].lostCounter, 0u);
+      EXPECT_FLOAT_EQ(store.cold[0].track.X[STATE_X], 4.4f);
+      EXPECT_FLOAT_EQ(store.cold[0].track.X[STATE_Y], 3.f);
+      EXPECT_FLOAT_EQ(store.cold[0].track.X[STATE_VX], 10.f);
+      EXPECT_FLOAT_EQ(store.cold[0].track.X[STATE_VY], 0.f);
 
       // Assert that the object was associated and fused, and no new object was created.
       // This is under the assumption that the new object is created on the next available slot.
-      ASSERT_EQ(fusedObjectList[1].id, 0u);
+      ASSERT_EQ(store.hot[1].id, 0u);
    }
    
    // Case 6.2
@@ -203,28 +197,26 @@ namespace
    {
       CreatePrefusedObject(&prefusedObjectList[0], &sensorList[FRONT_LEFT], 4.f, 3.f, 10.f, 0.f);
 
-      RunFusion(prefusedObjectList, fusedObjectList);
-      (void)memset(prefusedObjectList, 0, sizeof(PrefusedObject_t) * (u32_t)NUM_PREFUSED_OBJ);
+      RunFusion(prefusedObjectList, 1u, &store, CYCLE_TIME);
 
-      ASSERT_EQ(fusedObjectList[0].id, 1u);
-      ASSERT_EQ(fusedObjectList[1].id, 0u);
+      ASSERT_EQ(store.hot[0].id, 1u);
+      ASSERT_EQ(store.hot[1].id, 0u);
 
       CreatePrefusedObject(&prefusedObjectList[0], &sensorList[REAR_LEFT], -4.f, 3.f, 10.f, 0.f);
 
-      RunFusion(prefusedObjectList, fusedObjectList);
-      (void)memset(prefusedObjectList, 0, sizeof(PrefusedObject_t) * (u32_t)NUM_PREFUSED_OBJ);
+      RunFusion(prefusedObjectList, 1u, &store, CYCLE_TIME);
 
-      EXPECT_EQ(fusedObjectList[0].id, 1u);
-      EXPECT_EQ(fusedObjectList[0].lifetimeCounter, 2u);
-      EXPECT_EQ(fusedObjectList[0].lostCounter, 1u);
+      EXPECT_EQ(store.hot[0].id, 1u);
+      EXPECT_EQ(store.cold[0].lifetimeCounter, 2u);
+      EXPECT_EQ(store.hot[0].lostCounter, 1u);
 
-      EXPECT_EQ(fusedObjectList[1].id, 2u);
-      EXPECT_EQ(fusedObjectList[1].lifetimeCounter, 1u);
-      EXPECT_EQ(fusedObjectList[1].lostCounter, 0u);
-      EXPECT_FLOAT_EQ(fusedObjectList[1].track.X[STATE_X], -4.f);
-      EXPECT_FLOAT_EQ(fusedObjectList[1].track.X[STATE_Y], 3.f);
-      EXPECT_FLOAT_EQ(fusedObjectList[1].track.X[STATE_VX], 10.f);
-      EXPECT_FLOAT_EQ(fusedObjectList[1].track.X[STATE_VY], 0.f);
+      EXPECT_EQ(store.hot[1].id, 2u);
+      EXPECT_EQ(store.cold[1].lifetimeCounter, 1u);
+      EXPECT_EQ(store.hot[1].lostCounter, 0u);
+      EXPECT_FLOAT_EQ(store.cold[1].track.X[STATE_X], -4.f);
+      EXPECT_FLOAT_EQ(store.cold[1].track.X[STATE_Y], 3.f);
+      EXPECT_FLOAT_EQ(store.cold[1].track.X[STATE_VX], 10.f);
+      EXPECT_FLOAT_EQ(store.cold[1].track.X[STATE_VY], 0.f);
    }
 
    // Case 8.1
@@ -237,14 +229,13 @@ namespace
          CreatePrefusedObject(&prefusedObjectList[i], &sensorList[FRONT_LEFT], i * 10.f, 3.f, 10.f, 0.f);
       }
 
-      RunFusion(prefusedObjectList, fusedObjectList);
-      (void)memset(prefusedObjectList, 0, sizeof(PrefusedObject_t) * (u32_t)NUM_PREFUSED_OBJ);
+      RunFusion(prefusedObjectList, (u8_t)(NUM_FUSED_OBJ - 1), &store, CYCLE_TIME);
 
       for (int i = 0; (i < NUM_FUSED_OBJ - 1); i++)
       {
-         ASSERT_NE(fusedObjectList[i].id, 0u);
+         ASSERT_NE(store.hot[i].id, 0u);
       }
-      ASSERT_EQ(fusedObjectList[NUM_FUSED_OBJ - 1].id, 0u);
+      ASSERT_EQ(store.hot[NUM_FUSED_OBJ - 1].id, 0u);
       
       // Update the 15 prefused objects
       for (int i = 0; (i < NUM_FUSED_OBJ - 1); i++)
@@ -255,22 +246,21 @@ namespace
       // Create the 16th prefused object, so one fused object gets deleted
       CreatePrefusedObject(&prefusedObjectList[NUM_FUSED_OBJ - 1], &sensorList[FRONT_LEFT], 5.f, 20.f, 10.f, 0.f);
 
-      RunFusion(prefusedObjectList, fusedObjectList);
-      (void)memset(prefusedObjectList, 0, sizeof(PrefusedObject_t) * (u32_t)NUM_PREFUSED_OBJ);
+      RunFusion(prefusedObjectList, (u8_t)NUM_FUSED_OBJ, &store, CYCLE_TIME);
 
       for (int i = 0; (i < NUM_FUSED_OBJ - 1); i++)
       {
-         ASSERT_NE(fusedObjectList[i].id, 0u);
+         ASSERT_NE(store.hot[i].id, 0u);
       }
 
       // The 16th prefused object, should replace the object with the lowest priority, which is the last of the list.
-      EXPECT_EQ(fusedObjectList[NUM_FUSED_OBJ - 1].id, 16u);
-      EXPECT_EQ(fusedObjectList[NUM_FUSED_OBJ - 1].lifetimeCounter, 1u);
-      EXPECT_EQ(fusedObjectList[NUM_FUSED_OBJ - 1].lostCounter, 0u);
-      EXPECT_FLOAT_EQ(fusedObjectList[NUM_FUSED_OBJ - 1].track.X[STATE_X], 5.f);
-      EXPECT_FLOAT_EQ(fusedObjectList[NUM_FUSED_OBJ - 1].track.X[STATE_Y], 20.f);
-      EXPECT_FLOAT_EQ(fusedObjectList[NUM_FUSED_OBJ - 1].track.X[STATE_VX], 10.f);
-      EXPECT_FLOAT_EQ(fusedObjectList[NUM_FUSED_OBJ - 1].track.X[STATE_VY], 0.f);
+      EXPECT_EQ(store.hot[NUM_FUSED_OBJ - 1].id, 16u);
+      EXPECT_EQ(store.cold[NUM_FUSED_OBJ - 1].lifetimeCounter, 1u);
+      EXPECT_EQ(store.hot[NUM_FUSED_OBJ - 1].lostCounter, 0u);
+      EXPECT_FLOAT_EQ(store.cold[NUM_FUSED_OBJ - 1].track.X[STATE_X], 5.f);
+      EXPECT_FLOAT_EQ(store.cold[NUM_FUSED_OBJ - 1].track.X[STATE_Y], 20.f);
+      EXPECT_FLOAT_EQ(store.cold[NUM_FUSED_OBJ - 1].track.X[STATE_VX], 10.f);
+      EXPECT_FLOAT_EQ(store.cold[NUM_FUSED_OBJ - 1].track.X[STATE_VY], 0.f);
 
       // TODO: Check that deleteObject() was called!
    }
@@ -280,36 +270,34 @@ namespace
    {
       CreatePrefusedObject(&prefusedObjectList[0], &sensorList[FRONT_LEFT], 4.f, 3.f, 10.f, 0.f);
 
-      RunFusion(prefusedObjectList, fusedObjectList);
-      (void)memset(prefusedObjectList, 0, sizeof(PrefusedObject_t) * (u32_t)NUM_PREFUSED_OBJ);
+      RunFusion(prefusedObjectList, 1u, &store, CYCLE_TIME);
 
-      ASSERT_EQ(fusedObjectList[0].id, 1u);
-      ASSERT_EQ(fusedObjectList[1].id, 0u);
-      ASSERT_EQ(fusedObjectList[2].id, 0u);
+      ASSERT_EQ(store.hot[0].id, 1u);
+      ASSERT_EQ(store.hot[1].id, 0u);
+      ASSERT_EQ(store.hot[2].id, 0u);
 
       CreatePrefusedObject(&prefusedObjectList[0], &sensorList[FRONT_LEFT], 4.4f, 3.f, 10.f, 0.f);
       CreatePrefusedObject(&prefusedObjectList[1], &sensorList[REAR_LEFT], -4.f, 3.f, 10.f, 0.f);
 
-      RunFusion(prefusedObjectList, fusedObjectList);
-      (void)memset(prefusedObjectList, 0, sizeof(PrefusedObject_t) * (u32_t)NUM_PREFUSED_OBJ);
-
-      EXPECT_EQ(fusedObjectList[0].id, 1u);
-      EXPECT_EQ(fusedObjectList[0].lifetimeCounter, 2u);
-      EXPECT_EQ(fusedObjectList[0].lostCounter, 0u);
-      EXPECT_FLOAT_EQ(fusedObjectList[0].track.X[STATE_X], 4.4f);
-      EXPECT_FLOAT_EQ(fusedObjectList[0].track.X[STATE_Y], 3.f);
-      EXPECT_FLOAT_EQ(fusedObjectList[0].track.X[STATE_VX], 10.f);
-      EXPECT_FLOAT_EQ(fusedObjectList[0].track.X[STATE_VY], 0.f);
-
-      EXPECT_EQ(fusedObjectList[1].id, 2u);
-      EXPECT_EQ(fusedObjectList[1].lifetimeCounter, 1u);
-      EXPECT_EQ(fusedObjectList[1].lostCounter, 0u);
-      EXPECT_FLOAT_EQ(fusedObjectList[1].track.X[STATE_X], -4.f);
-      EXPECT_FLOAT_EQ(fusedObjectList[1].track.X[STATE_Y], 3.f);
-      EXPECT_FLOAT_EQ(fusedObjectList[1].track.X[STATE_VX], 10.f);
-      EXPECT_FLOAT_EQ(fusedObjectList[1].track.X[STATE_VY], 0.f);
-
-      ASSERT_EQ(fusedObjectList[2].id, 0u);
+      RunFusion(prefusedObjectList, 2u, &store, CYCLE_TIME);
+
+      EXPECT_EQ(store.hot[0].id, 1u);
+      EXPECT_EQ(store.cold[0].lifetimeCounter, 2u);
+      EXPECT_EQ(store.hot[0].lostCounter, 0u);
+      EXPECT_FLOAT_EQ(store.cold[0].track.X[STATE_X], 4.4f);
+      EXPECT_FLOAT_EQ(store.cold[0].track.X[STATE_Y], 3.f);
+      EXPECT_FLOAT_EQ(store.cold[0].track.X[STATE_VX], 10.f);
+      EXPECT_FLOAT_EQ(store.cold[0].track.X[STATE_VY], 0.f);
+
+      EXPECT_EQ(store.hot[1].id, 2u);
+      EXPECT_EQ(store.cold[1].lifetimeCounter, 1u);
+      EXPECT_EQ(store.hot[1].lostCounter, 0u);
+      EXPECT_FLOAT_EQ(store.cold[1].track.X[STATE_X], -4.f);
+      EXPECT_FLOAT_EQ(store.cold[1].track.X[STATE_Y], 3.f);
+      EXPECT_FLOAT_EQ(store.cold[1].track.X[STATE_VX], 10.f);
+      EXPECT_FLOAT_EQ(store.cold[1].track.X[STATE_VY], 0.f);
+
+      ASSERT_EQ(store.hot[2].id, 0u);
    }
    
    // Case 8.3.1
@@ -317,27 +305,25 @@ namespace
    {
       CreatePrefusedObject(&prefusedObjectList[0], &sensorList[FRONT_LEFT], -1.9f, 3.f, 10.f, 0.f);
 
-      RunFusion(prefusedObjectList, fusedObjectList);
-      (void)memset(prefusedObjectList, 0, sizeof(PrefusedObject_t) * (u32_t)NUM_PREFUSED_OBJ);
+      RunFusion(prefusedObjectList, 1u, &store, CYCLE_TIME);
 
-      ASSERT_EQ(fusedObjectList[0].id, 1u);
-      ASSERT_EQ(fusedObjectList[1].id, 0u);
+      ASSERT_EQ(store.hot[0].id, 1u);
+      ASSERT_EQ(store.hot[1].id, 0u);
 
       CreatePrefusedObject(&prefusedObjectList[0], &sensorList[FRONT_LEFT], -1.5f, 3.f, 10.f, 0.f);
       CreatePrefusedObject(&prefusedObjectList[1], &sensorList[FRONT_LEFT], -1.5f, 3.f, 10.f, 0.f);
 
-      RunFusion(prefusedObjectList, fusedObjectList);
-      (void)memset(prefusedObjectList, 0, sizeof(PrefusedObject_t) * (u32_t)NUM_PREFUSED_OBJ);
+      RunFusion(prefusedObjectList, 2u, &store, CYCLE_TIME);
 
-      EXPECT_EQ(fusedObjectList[0].id, 1u);
-      EXPECT_EQ(fusedObjectList[0].lifetimeCounter, 2u);
-      EXPECT_EQ(fusedObjectList[0].lostCounter, 0u);
-      EXPECT_FLOAT_EQ(fusedObjectList[0].track.X[STATE_X], -1.5f);
-      EXPECT_FLOAT_EQ(fusedObjectList[0].track.X[STATE_Y], 3.f);
-      EXPECT_FLOAT_EQ(fusedObjectList[0].track.X[STATE_VX], 10.f);
-      EXPECT_FLOAT_EQ(fusedObjectList[0].track.X[STATE_VY], 0.f);
+      EXPECT_EQ(store.hot[0].id, 1u);
+      EXPECT_EQ(store.cold[0].lifetimeCounter, 2u);
+      EXPECT_EQ(store.hot[0].lostCounter, 0u);
+      EXPECT_FLOAT_EQ(store.cold[0].track.X[STATE_X], -1.5f);
+      EXPECT_FLOAT_EQ(store.cold[0].track.X[STATE_Y], 3.f);
+      EXPECT_FLOAT_EQ(store.cold[0].track.X[STATE_VX], 10.f);
+      EXPECT_FLOAT_EQ(store.cold[0].track.X[STATE_VY], 0.f);
 
-      ASSERT_EQ(fusedObjectList[1].id, 0u);
+      ASSERT_EQ(store.hot[1].id, 0u);
    }
    
    // Case 8.3.2
@@ -345,27 +331,25 @@ namespace
    {
       CreatePrefusedObject(&prefusedObjectList[0], &sensorList[FRONT_LEFT], -1.9f, 3.f, 10.f, 0.f);
 
-      RunFusion(prefusedObjectList, fusedObjectList);
-      (void)memset(prefusedObjectList, 0, sizeof(PrefusedObject_t) * (u32_t)NUM_PREFUSED_OBJ);
+      RunFusion(prefusedObjectList, 1u, &store, CYCLE_TIME);
 
-      ASSERT_EQ(fusedObjectList[0].id, 1u);
-      ASSERT_EQ(fusedObjectList[1].id, 0u);
+      ASSERT_EQ(store.hot[0].id, 1u);
+      ASSERT_EQ(store.hot[1].id, 0u);
 
       CreatePrefusedObject(&prefusedObjectList[0], &sensorList[FRONT_LEFT], -1.5f, 3.f, 10.f, 0.f);
       CreatePrefusedObject(&prefusedObjectList[1], &sensorList[REAR_LEFT], -1.5f, 3.f, 10.f, 0.f);
 
-      RunFusion(prefusedObjectList, fusedObjectList);
-      (void)memset(prefusedObjectList, 0, sizeof(PrefusedObject_t) * (u32_t)NUM_PREFUSED_OBJ);
+      RunFusion(prefusedObjectList, 2u, &store, CYCLE_TIME);
 
-      EXPECT_EQ(fusedObjectList[0].id, 1u);
-      EXPECT_EQ(fusedObjectList[0].lifetimeCounter, 2u);
-      EXPECT_EQ(fusedObjectList[0].lostCounter, 0u);
-      EXPECT_FLOAT_EQ(fusedObjectList[0].track.X[STATE_X], -1.5f);
-      EXPECT_FLOAT_EQ(fusedObjectList[0].track.X[STATE_Y], 3.f);
-      EXPECT_FLOAT_EQ(fusedObjectList[0].track.X[STATE_VX], 10.f);
-      EXPECT_FLOAT_EQ(fusedObjectList[0].track.X[STATE_VY], 0.f);
+      EXPECT_EQ(store.hot[0].id, 1u);
+      EXPECT_EQ(store.cold[0].lifetimeCounter, 2u);
+      EXPECT_EQ(store.hot[0].lostCounter, 0u);
+      EXPECT_FLOAT_EQ(store.cold[0].track.X[STATE_X], -1.5f);
+      EXPECT_FLOAT_EQ(store.cold[0].track.X[STATE_Y], 3.f);
+      EXPECT_FLOAT_EQ(store.cold[0].track.X[STATE_VX], 10.f);
+      EXPECT_FLOAT_EQ(store.cold[0].track.X[STATE_VY], 0.f);
 
-      ASSERT_EQ(fusedObjectList[1].id, 0u);
+      ASSERT_EQ(store.hot[1].id, 0u);
    }
 
    // TODO: Decrease the MAX_COASTING_CYCLES macro (monkey patch), to make the test faster
@@ -373,27 +357,24 @@ namespace
    {
       CreatePrefusedObject(&prefusedObjectList[0], &sensorList[FRONT_LEFT], 4.f, 3.f, 10.f, 0.f);
 
-      RunFusion(prefusedObjectList, fusedObjectList);
-      (void)memset(prefusedObjectList, 0, sizeof(PrefusedObject_t) * (u32_t)NUM_PREFUSED_OBJ);
+      RunFusion(prefusedObjectList, 1u, &store, CYCLE_TIME);
 
-      EXPECT_EQ(fusedObjectList[0].id, 1u);
-      EXPECT_EQ(fusedObjectList[0].lifetimeCounter, 1u);
-      EXPECT_EQ(fusedObjectList[0].lostCounter, 0u);
+      EXPECT_EQ(store.hot[0].id, 1u);
+      EXPECT_EQ(store.cold[0].lifetimeCounter, 1u);
+      EXPECT_EQ(store.hot[0].lostCounter, 0u);
 
       for (int i = 0; i < MAX_COASTING_CYCLES; i++)
       {
-         RunFusion(prefusedObjectList, fusedObjectList);
-         (void)memset(prefusedObjectList, 0, sizeof(PrefusedObject_t) * (u32_t)NUM_PREFUSED_OBJ);
+         RunFusion(prefusedObjectList, 0u, &store, CYCLE_TIME);
 
-         EXPECT_EQ(fusedObjectList[0].id, 1u);
-         EXPECT_EQ(fusedObjectList[0].lifetimeCounter, (u8_t)(i + 2));
-         EXPECT_EQ(fusedObjectList[0].lostCounter, (u8_t)(i + 1));
+         EXPECT_EQ(store.hot[0].id, 1u);
+         EXPECT_EQ(store.cold[0].lifetimeCounter, (u8_t)(i + 2));
+         EXPECT_EQ(store.hot[0].lostCounter, (u8_t)(i + 1));
       }
 
-      RunFusion(prefusedObjectList, fusedObjectList);
-      (void)memset(prefusedObjectList, 0, sizeof(PrefusedObject_t) * (u32_t)NUM_PREFUSED_OBJ);
+      RunFusion(prefusedObjectList, 0u, &store, CYCLE_TIME);
 
-      EXPECT_EQ(fusedObjectList[0].id, 0u);
+      EXPECT_EQ(store.hot[0].id, 0u);
    }
 
    // Stress testing
@@ -406,12 +387,11 @@ namespace
          CreatePrefusedObject(&prefusedObjectList[i], &sensorList[FRONT_RIGHT], i * 10.f, -3.f, 10.f, 0.f);
       }
 
-      RunFusion(prefusedObjectList, fusedObjectList);
-      (void)memset(prefusedObjectList, 0, sizeof(PrefusedObject_t) * (u32_t)NUM_PREFUSED_OBJ);
+      RunFusion(prefusedObjectList, (u8_t)NUM_PREFUSED_OBJ, &store, CYCLE_TIME);
 
       for (int i = 0; i < NUM_FUSED_OBJ; i++)
       {
-         EXPECT_NE(fusedObjectList[i].id, 0u);
+         EXPECT_NE(store.hot[i].id, 0u);
       }
 
       for (int i = 0; i < NUM_PREFUSED_OBJ; i++)
@@ -419,12 +399,11 @@ namespace
          CreatePrefusedObject(&prefusedObjectList[i], &sensorList[FRONT_RIGHT], (i * 10.f) + 0.4f, -3.f, 10.f, 0.f);
       }
 
-      RunFusion(prefusedObjectList, fusedObjectList);
-      (void)memset(prefusedObjectList, 0, sizeof(PrefusedObject_t) * (u32_t)NUM_PREFUSED_OBJ);
+      RunFusion(prefusedObjectList, (u8_t)NUM_PREFUSED_OBJ, &store, CYCLE_TIME);
 
       for (int i = 0; i < NUM_FUSED_OBJ; i++)
       {
-         EXPECT_NE(fusedObjectList[i].id, 0u);
+         EXPECT_NE(store.hot[i].id, 0u);
       }
    }
 
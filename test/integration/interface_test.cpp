@@ -19,11 +19,14 @@
 
 #include "gtest/gtest.h"
 
+#include <string.h>
+
+#include "sensor_interface.h"
+
 #include "platform_params.h"
 #include "config.h"
 #include "reconfigure.h"
-
-#include "interface.c"
+#include "algorithm_interface.h"
 
 
 namespace
@@ -43,13 +46,18 @@ namespace
 
       virtual void SetUp()
       {
-         InitializeAlgorithm();
+         Sensor_t* sensor;
+
+         (void)InitializeAlgorithm(NULL);
 
          resetInputObjectList();
 
-         for (int i = 0; i < NUM_SENSORS; i++)
+         for (u8_t i = 0u; i < NUM_PREFUSED_OBJ; i++)
          {
-            sensorList[i].tf.canX = 0.f;  // Set to 0 so no offset is applied
+            if (GetSensorFromIndex(i, &sensor))
+            {
+               sensor->tf.canX = 0.f;  // Set to 0 so no offset is applied
+            }
          }
       }
 
@@ -69,9 +77,12 @@ namespace
    // All tests are based on this assumption
    TEST_F(InterfaceTest, prefusedListLenghtSum)
    {
+       Sensor_t sensorList[NUM_SENSORS];
        u8_t sum = 0;
 
-       for (int i = 0; i < NUM_SENSORS; i++)
+       InitializeSensorInterface(sensorList);
+
+       for (u8_t i = 0u; i < NUM_SENSORS; i++)
        {
            sum += sensorList[i].objects.length;
        }
@@ -93,14 +104,14 @@ namespace
       inputObjectList[0].velX = 10.f;
       inputObjectList[0].velY = 0.f;
 
-      RunAlgorithm(inputObjectList, outputObjectList);
+      RunAlgorithm(inputObjectList, outputObjectList, CYCLE_TIME);
       resetInputObjectList();
 
       for (int i = 0; i < (MIN_LIFETIME_TX_CYCLES - 1); i++)
       {
          ASSERT_EQ(outputObjectList[0].valid, 0u);
 
-         RunAlgorithm(inputObjectList, outputObjectList);
+         RunAlgorithm(inputObjectList, outputObjectList, CYCLE_TIME);
       }
 
       EXPECT_TRUE(outputObjectList[0].valid);
@@ -126,10 +137,10 @@ namespace
       inputObjectList[16].velX = 10.f;
       inputObjectList[16].velY = 0.f;
 
-      RunAlgorithm(inputObjectList, outputObjectList);
+      RunAlgorithm(inputObjectList, outputObjectList, CYCLE_TIME);
       resetInputObjectList();
-      RunAlgorithm(inputObjectList, outputObjectList);
-      RunAlgorithm(inputObjectList, outputObjectList);
+      RunAlgorithm(inputObjectList, outputObjectList, CYCLE_TIME);
+      RunAlgorithm(inputObjectList, outputObjectList, CYCLE_TIME);
 
       EXPECT_TRUE(outputObjectList[0].valid);
       EXPECT_FLOAT_EQ(outputObjectList[0].posX, -1.2f);
@@ -154,10 +165,10 @@ namespace
       inputObjectList[8].velX = 10.f;
       inputObjectList[8].velY = 0.f;
 
-      RunAlgorithm(inputObjectList, outputObjectList);
+      RunAlgorithm(inputObjectList, outputObjectList, CYCLE_TIME);
       resetInputObjectList();
-      RunAlgorithm(inputObjectList, outputObjectList);
-      RunAlgorithm(inputObjectList, outputObjectList);
+      RunAlgorithm(inputObjectList, outputObjectList, CYCLE_TIME);
+      RunAlgorithm(inputObjectList, outputObjectList, CYCLE_TIME);
 
       EXPECT_TRUE(outputObjectList[0].valid);
       EXPECT_FLOAT_EQ(outputObjectList[0].posX, -1.2f);
@@ -182,10 +193,10 @@ namespace
       inputObjectList[4].velX = 0.f;
       inputObjectList[4].velY = 10.f;
 
-      RunAlgorithm(inputObjectList, outputObjectList);
+      RunAlgorithm(inputObjectList, outputObjectList, CYCLE_TIME);
       resetInputObjectList();
-      RunAlgorithm(inputObjectList, outputObjectList);
-      RunAlgorithm(inputObjectList, outputObjectList);
+      RunAlgorithm(inputObjectList, outputObjectList, CYCLE_TIME);
+      RunAlgorithm(inputObjectList, outputObjectList, CYCLE_TIME);
 
       EXPECT_TRUE(outputObjectList[0].valid);
       EXPECT_FLOAT_EQ(outputObjectList[0].posX, 15.f);
@@ -210,10 +221,10 @@ namespace
       inputObjectList[16].velX = 0.f;
       inputObjectList[16].velY = -10.f;
 
-      RunAlgorithm(inputObjectList, outputObjectList);
+      RunAlgorithm(inputObjectList, outputObjectList, CYCLE_TIME);
       resetInputObjectList();
-      RunAlgorithm(inputObjectList, outputObjectList);
-      RunAlgorithm(inputObjectList, outputObjectList);
+      RunAlgorithm(inputObjectList, outputObjectList, CYCLE_TIME);
+      RunAlgorithm(inputObjectList, outputObjectList, CYCLE_TIME);
 
       EXPECT_TRUE(outputObjectList[0].valid);
       EXPECT_FLOAT_EQ(outputObjectList[0].posX, -15.f);
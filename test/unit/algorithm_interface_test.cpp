@@ -0,0 +1,215 @@
+/*
+ * Copyright (C) 2016 Dimitris Geromichalos
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "stdafx.h"
+
+#include <string.h>
+
+#include "gtest/gtest.h"
+
+#include "platform_params.h"
+#include "algorithm_interface.h"
+
+#define NUM_CYCLES (10u)
+
+namespace
+{
+
+   class AlgorithmInterfaceTest : public testing::Test
+   {
+   protected:
+
+      AlgorithmInterfaceTest()
+      {
+      }
+
+      virtual ~AlgorithmInterfaceTest()
+      {
+      }
+
+      virtual void SetUp()
+      {
+         InitializeAlgorithm(NULL);
+
+         (void)memset(inputObjectList, 0, sizeof(inputObjectList));
+      }
+
+      virtual void TearDown()
+      {
+      }
+
+      /* A few objects of both the front sensors, moving between the cycles. */
+      void SetInputObjects(const u32_t cycle)
+      {
+         const u8_t indices[] = { 0u, 5u, 13u, 23u };
+
+         for (u8_t k = 0u; k < (sizeof(indices) / sizeof(indices[0])); k++)
+         {
+            BaseObject_t* inputObject = &inputObjectList[indices[k]];
+
+            inputObject->valid = 1u;
+            inputObject->id = k + 1u;
+            inputObject->posX = 10.f + (20.f * k) + (0.4f * cycle);
+            inputObject->posY = (k % 2u) ? -4.f : 4.f;
+            inputObject->velX = 10.f;
+            inputObject->velY = 0.f;
+         }
+      }
+
+      BaseObject_t inputObjectList[NUM_PREFUSED_OBJ];
+      BaseObject_t outputObjectList[NUM_FUSED_OBJ];
+   };
+
+   TEST_F(AlgorithmInterfaceTest, addedObjectsMatchInputList)
+   {
+      BaseObject_t expectedOutput[NUM_CYCLES][NUM_FUSED_OBJ];
+
+      for (u32_t cycle = 0u; cycle < NUM_CYCLES; cycle++)
+      {
+         SetInputObjects(cycle);
+         RunAlgorithm(inputObjectList, expectedOutput[cycle], CYCLE_TIME);
+      }
+
+      InitializeAlgorithm(NULL);
+
+      for (u32_t cycle = 0u; cycle < NUM_CYCLES; cycle++)
+      {
+         SetInputObjects(cycle);
+
+         for (u8_t i = 0u; i < NUM_PREFUSED_OBJ; i++)
+         {
+            const BaseObject_t* inputObject = &inputObjectList[i];
+
+            if (inputObject->valid)
+            {
+               AddInputObject(i, inputObject->id, inputObject->posX, inputObject->posY, inputObject->velX, inputObject->velY);
+            }
+         }
+
+         RunAlgorithmOnInputObjects(outputObjectList, CYCLE_TIME);
+
+         EXPECT_EQ(memcmp(outputObjectList, expectedOutput[cycle], sizeof(outputObjectList)), 0);
+      }
+
+      EXPECT_TRUE(outputObjectList[0].valid);
+   }
+
+   TEST_F(AlgorithmInterfaceTest, excessObjectsAreIgnored)
+   {
+      for (u32_t cycle = 0u; cycle < NUM_CYCLES; cycle++)
+      {
+         /* No sensor has objects beyond the input object list. */
+         AddInputObject(NUM_PREFUSED_OBJ, 1u, 10.f, 0.f, 0.f, 0.f);
+
+         RunAlgorithmOnInputObjects(outputObjectList, CYCLE_TIME);
+
+         EXPECT_FALSE(outputObjectList[0].valid);
+      }
+
+      /* More objects than the prefused object list holds, all at the same spot. */
+      for (u32_t cycle = 0u; cycle < NUM_CYCLES; cycle++)
+      {
+         for (u8_t k = 0u; k < (2u * NUM_PREFUSED_OBJ); k++)
+         {
+            AddInputObject(0u, 1u, 10.f, 0.f, 0.f, 0.f);
+         }
+
+         RunAlgorithmOnInputObjects(outputObjectList, CYCLE_TIME);
+      }
+
+      EXPECT_TRUE(outputObjectList[0].valid);
+      EXPECT_FALSE(outputObjectList[1].valid);
+   }
+
+   TEST_F(AlgorithmInterfaceTest, configuredCapacitiesAreKept)
+   {
+      /* Zero capacities are set to the maximum ones. */
+      const AlgorithmConfig_t config = { 0u, 2u, 1u, 0u };
+      u8_t numValid;
+
+      EXPECT_TRUE(InitializeAlgorithm(&config));
+
+      EXPECT_EQ(GetAlgorithmConfig()->numPrefusedObjects, NUM_PREFUSED_OBJ);
+      EXPECT_EQ(GetAlgorithmConfig()->numFusedObjects, 2u);
+      EXPECT_EQ(GetAlgorithmConfig()->numSensors, 1u);
+      EXPECT_EQ(GetAlgorithmConfig()->maxId, MAX_ID);
+
+      /* Reinitializing with the current configuration keeps it. */
+      EXPECT_TRUE(InitializeAlgorithm(GetAlgorithmConfig()));
+
+      EXPECT_EQ(GetAlgorithmConfig()->numFusedObjects, 2u);
+
+      /* The objects of the second sensor are ignored, and the first sensor has two objects. */
+      for (u32_t cycle = 0u; cycle < NUM_CYCLES; cycle++)
+      {
+         AddInputObject(0u, 1u, 10.f + (0.4f * cycle), 4.f, 10.f, 0.f);
+         AddInputObject(5u, 2u, 30.f + (0.4f * cycle), -4.f, 10.f, 0.f);
+         AddInputObject(13u, 3u, 50.f + (0.4f * cycle), 4.f, 10.f, 0.f);
+
+         RunAlgorithmOnInputObjects(outputObjectList, CYCLE_TIME);
+      }
+
+      numValid = 0u;
+
+      for (u8_t i = 0u; i < NUM_FUSED_OBJ; i++)
+      {
+         numValid += outputObjectList[i].valid ? 1u : 0u;
+      }
+
+      EXPECT_EQ(numValid, 2u);
+
+      /* A third object of the first sensor finds no free slot, so it can only replace one of the two. */
+      for (u32_t cycle = 0u; cycle < NUM_CYCLES; cycle++)
+      {
+         AddInputObject(0u, 1u, 14.f + (0.4f * cycle), 4.f, 10.f, 0.f);
+         AddInputObject(5u, 2u, 34.f + (0.4f * cycle), -4.f, 10.f, 0.f);
+         AddInputObject(6u, 4u, 5.f, -4.f, 0.f, 0.f);
+
+         RunAlgorithmOnInputObjects(outputObjectList, CYCLE_TIME);
+
+         numValid = 0u;
+
+         for (u8_t i = 0u; i < NUM_FUSED_OBJ; i++)
+         {
+            numValid += outputObjectList[i].valid ? 1u : 0u;
+         }
+
+         EXPECT_LE(numValid, 2u);
+      }
+
+      /* Only the output objects of the configured fused objects are written. */
+      outputObjectList[2].posX = 123.f;
+
+      RunAlgorithmOnInputObjects(outputObjectList, CYCLE_TIME);
+
+      EXPECT_EQ(outputObjectList[2].posX, 123.f);
+   }
+
+   TEST_F(AlgorithmInterfaceTest, tooFewIdsAreRejected)
+   {
+      /* The ID zero is invalid, so that four objects need a max ID of five. */
+      const AlgorithmConfig_t config = { 0u, 4u, 0u, 5u };
+      const AlgorithmConfig_t tooFewIds = { 0u, 4u, 0u, 4u };
+
+      EXPECT_TRUE(InitializeAlgorithm(&config));
+      EXPECT_FALSE(InitializeAlgorithm(&tooFewIds));
+
+      EXPECT_EQ(GetAlgorithmConfig()->numFusedObjects, 4u);
+      EXPECT_EQ(GetAlgorithmConfig()->maxId, 5u);
+   }
+
+}
@@ -0,0 +1,141 @@
+/*
+ * Copyright (C) 2016 Dimitris Geromichalos
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "stdafx.h"
+
+#include "gtest/gtest.h"
+
+#include <string.h>
+
+#include "platform_params.h"
+#include "constants.h"
+#include "assignment.h"
+
+#define NUM_ROWS (4u)
+#define NUM_COLS (6u)
+#define TOLERANCE (1e-4f)
+
+namespace
+{
+
+   class AssignmentTest : public testing::Test
+   {
+   protected:
+
+      AssignmentTest()
+      {
+      }
+
+      virtual ~AssignmentTest()
+      {
+      }
+
+      virtual void SetUp()
+      {
+         (void)memset(&workspace, 0, sizeof(AssignmentWorkspace_t));
+      }
+
+      virtual void TearDown()
+      {
+      }
+
+      /* The min cost over all the assignments of the rows, from the given row on. */
+      real_t GetBruteForceCost(const u8_t row, u8_t* usedCols)
+      {
+         real_t best = INFINITE_ASSIGNMENT_COST;
+
+         if (row == NUM_ROWS)
+         {
+            best = 0.f;
+         }
+         else
+         {
+            for (u8_t j = 0u; j < NUM_COLS; j++)
+            {
+               if (!usedCols[j])
+               {
+                  usedCols[j] = TRUE;
+
+                  real_t cost = workspace.cost[row][j] + GetBruteForceCost(row + 1u, usedCols);
+
+                  best = (cost < best) ? cost : best;
+                  usedCols[j] = FALSE;
+               }
+            }
+         }
+
+         return best;
+      }
+
+      AssignmentWorkspace_t workspace;
+   };
+
+   TEST_F(AssignmentTest, conflictIsSolvedGlobally)
+   {
+      u8_t assignment[2];
+
+      /* Greedy in row order would give column 0 to row 0 (total -11), the optimum is -17. */
+      workspace.cost[0][0] = -10.f;
+      workspace.cost[0][1] = -8.f;
+      workspace.cost[1][0] = -9.f;
+      workspace.cost[1][1] = -1.f;
+
+      SolveAssignment(&workspace, 2u, 2u, assignment);
+
+      EXPECT_EQ(assignment[0], 1u);
+      EXPECT_EQ(assignment[1], 0u);
+   }
+
+   TEST_F(AssignmentTest, solutionIsOptimal)
+   {
+      u8_t assignment[NUM_ROWS];
+      u8_t usedCols[NUM_COLS];
+      u32_t seed = 12345u;
+
+      for (int trial = 0; trial < 100; trial++)
+      {
+         for (u8_t i = 0u; i < NUM_ROWS; i++)
+         {
+            for (u8_t j = 0u; j < NUM_COLS; j++)
+            {
+               seed = (seed * 1103515245u) + 12345u;
+               workspace.cost[i][j] = ((real_t)((seed >> 8u) % 1000u) / 10.f) - 80.f;
+            }
+         }
+
+         SolveAssignment(&workspace, NUM_ROWS, NUM_COLS, assignment);
+
+         real_t cost = 0.f;
+
+         (void)memset(usedCols, FALSE, sizeof(usedCols));
+
+         for (u8_t i = 0u; i < NUM_ROWS; i++)
+         {
+            ASSERT_LT(assignment[i], NUM_COLS);
+            EXPECT_FALSE(usedCols[assignment[i]]);
+
+            usedCols[assignment[i]] = TRUE;
+            cost += workspace.cost[i][assignment[i]];
+         }
+
+         (void)memset(usedCols, FALSE, sizeof(usedCols));
+
+         EXPECT_NEAR(cost, GetBruteForceCost(0u, usedCols), TOLERANCE);
+      }
+   }
+
+}
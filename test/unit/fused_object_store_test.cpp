@@ -0,0 +1,164 @@
+/*
+ * Copyright (C) 2016 Dimitris Geromichalos
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "stdafx.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#include "gtest/gtest.h"
+
+#include "tracking.h"
+#include "fused_object_store.h"
+
+namespace
+{
+
+   class FusedObjectStoreTest : public testing::Test
+   {
+   protected:
+
+      FusedObjectStoreTest()
+      {
+      }
+
+      virtual ~FusedObjectStoreTest()
+      {
+      }
+
+      virtual void SetUp()
+      {
+         ResetFusedObjectStore(&store);
+      }
+
+      virtual void TearDown()
+      {
+      }
+
+      /* An object whose every field depends on its index. */
+      void GetTestObject(const u8_t index, FusedObject_t* fusedObject)
+      {
+         Plot_t plot;
+
+         (void)memset(fusedObject, 0, sizeof(FusedObject_t));
+         (void)memset(&plot, 0, sizeof(Plot_t));
+
+         fusedObject->id = index + 1u;
+         fusedObject->lifetimeCounter = 100u + index;
+         fusedObject->lostCounter = index % 3u;
+         fusedObject->priority = 10.f * index;
+
+         for (u8_t i = 0u; i < NUM_SENSORS; i++)
+         {
+            fusedObject->seenThisCycle[i] = ((index + i) % 2u);
+         }
+
+         for (u8_t i = 0u; i < KALMAN_STATES; i++)
+         {
+            plot.Z[i] = index + (0.25f * i);
+            plot.R[(KALMAN_STATES * i) + i] = 1.f + (0.1f * index) + (0.5f * i);
+         }
+
+         InitializeTrack(&fusedObject->track, &plot);
+      }
+
+      FusedObjectStore_t store;
+   };
+
+   TEST_F(FusedObjectStoreTest, storedObjectsAreGatheredBack)
+   {
+      FusedObject_t expected, actual;
+
+      for (u8_t index = 0u; index < NUM_FUSED_OBJ; index++)
+      {
+         GetTestObject(index, &expected);
+         SetFusedObject(&store, index, &expected);
+      }
+
+      for (u8_t index = 0u; index < NUM_FUSED_OBJ; index++)
+      {
+         GetTestObject(index, &expected);
+         GetFusedObject(&store, index, &actual);
+
+         EXPECT_EQ(actual.id, expected.id);
+         EXPECT_EQ(actual.lifetimeCounter, expected.lifetimeCounter);
+         EXPECT_EQ(actual.lostCounter, expected.lostCounter);
+         EXPECT_EQ(actual.priority, expected.priority);
+         EXPECT_EQ(memcmp(actual.seenThisCycle, expected.seenThisCycle, sizeof(actual.seenThisCycle)), 0);
+         EXPECT_EQ(memcmp(&actual.track, &expected.track, sizeof(Track_t)), 0);
+
+         /* The hot record mirrors the mean and the variances of the track, and starts on a cache line. */
+         EXPECT_EQ(((uintptr_t)&store.hot[index]) % CACHE_LINE_SIZE, 0u);
+
+         for (u8_t i = 0u; i < KALMAN_STATES; i++)
+         {
+            EXPECT_EQ(store.hot[index].X[i], expected.track.X[i]);
+            EXPECT_EQ(store.hot[index].variance[i], GetTrackVariance(&expected.track, i));
+         }
+      }
+   }
+
+   TEST_F(FusedObjectStoreTest, resetStoreHasNoValidObjects)
+   {
+      FusedObject_t fusedObject;
+
+      GetTestObject(3u, &fusedObject);
+      SetFusedObject(&store, 3u, &fusedObject);
+
+      ResetFusedObjectStore(&store);
+
+      for (u8_t index = 0u; index < NUM_FUSED_OBJ; index++)
+      {
+         GetFusedObject(&store, index, &fusedObject);
+
+         EXPECT_EQ(fusedObject.id, INVALID_ID);
+         EXPECT_EQ(fusedObject.lifetimeCounter, 0u);
+      }
+   }
+
+   TEST_F(FusedObjectStoreTest, liveObjectsAreVisitedInOrder)
+   {
+      FusedObject_t fusedObject;
+      u8_t numVisited = 0u;
+      u8_t previous = 0u;
+
+      for (u8_t index = 0u; index < NUM_FUSED_OBJ; index++)
+      {
+         GetTestObject(index, &fusedObject);
+         fusedObject.id = ((index % 3u) == 0u) ? INVALID_ID : fusedObject.id;
+         SetFusedObject(&store, index, &fusedObject);
+      }
+
+      for (u8_t i = GetNextLiveFusedObject(&store, 0u); i < NUM_FUSED_OBJ; i = GetNextLiveFusedObject(&store, i + 1u))
+      {
+         EXPECT_NE(store.hot[i].id, INVALID_ID);
+         EXPECT_TRUE((numVisited == 0u) || (i > previous));
+         previous = i;
+         numVisited++;
+      }
+
+      EXPECT_EQ(numVisited, NUM_FUSED_OBJ - ((NUM_FUSED_OBJ + 2u) / 3u));
+
+      /* Removing an object drops it from the live set. */
+      GetTestObject(1u, &fusedObject);
+      fusedObject.id = INVALID_ID;
+      SetFusedObject(&store, 1u, &fusedObject);
+
+      EXPECT_EQ(GetNextLiveFusedObject(&store, 0u), 2u);
+   }
+
+}
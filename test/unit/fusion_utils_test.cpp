@@ -19,23 +19,25 @@
 
 #include "gtest/gtest.h"
 
+#include <string.h>
+
 #include "can_protocol.h"
 
 #include "constants.h"
+#include "config.h"
 #include "platform_params.h"
 #include "fusion.h"
+#include "fusion_utils.h"
 #include "radar_utils.h"
-#include "tracking.h"
-#include "reconfigure.h"
-
-#include "util.c"
-#include "reconfigure.c"
-#include "algo_util.c"
+#include "gating.h"
 
 
 namespace
 {
 
+   /* The maximum capacities of the algorithm. */
+   const AlgorithmConfig_t algorithmConfig = { NUM_PREFUSED_OBJ, NUM_FUSED_OBJ, NUM_SENSORS, MAX_ID };
+
    class FusionUtilsTest : public testing::Test
    {
    protected:
@@ -50,7 +52,7 @@ namespace
 
       virtual void SetUp()
       {
-         InitializeFusion();
+         InitializeFusion(&algorithmConfig);
       }
 
       virtual void TearDown()
@@ -60,51 +62,60 @@ namespace
 
    TEST_F(FusionUtilsTest, priorityGEmaxCanValues)
    {
-      f32_t maxRange, maxX, maxY;
+      real_t maxX, maxY;
 
-      maxX = max(fabs(TX_OBJECT_DISTANCE_X_MAX), fabs(TX_OBJECT_DISTANCE_X_MIN));
-      maxY = max(fabs(TX_OBJECT_DISTANCE_Y_MAX), fabs(TX_OBJECT_DISTANCE_Y_MIN));
-      maxRange = GetRange(maxX, maxY);
+      maxX = REAL_FMAX(REAL_FABS(TX_OBJECT_DISTANCE_X_MAX), REAL_FABS(TX_OBJECT_DISTANCE_X_MIN));
+      maxY = REAL_FMAX(REAL_FABS(TX_OBJECT_DISTANCE_Y_MAX), REAL_FABS(TX_OBJECT_DISTANCE_Y_MIN));
 
-      ASSERT_GE(MAX_PRIORITY, maxRange);
+      /* An object at the CAN limits must still outrank a free slot (worst priority of -MAX_PRIORITY). */
+      ASSERT_GT(GetObjectPriority(maxX, maxY), (-1.f) * MAX_PRIORITY);
    }
 
    TEST_F(FusionUtilsTest, gatingLimitGTgatingInvalid)
    {
+      /* The limit that the total gating value of a pair must exceed. */
+      real_t totalGatingValueMinLimit = KALMAN_STATES * STATE_GATING_VALUE_MIN_LIMIT * ACCEPTANCE_GATE_SUM_FACTOR;
+
       ASSERT_GT(STATE_GATING_VALUE_MIN_LIMIT, INVALID_GATING_VALUE);
       ASSERT_GT(totalGatingValueMinLimit, INVALID_GATING_VALUE);
    }
 
    TEST_F(FusionUtilsTest, zeroVarianceGating)
    {
-      f32_t gatingQuality;
-
-      PrefusedObject_t prefusedObject;
-      FusedObject_t fusedObject;
-
-      prefusedObject.valid = TRUE;
-      prefusedObject.plot.Z[STATE_X] = 4.f;
-      prefusedObject.plot.Z[STATE_Y] = 3.f;
-      prefusedObject.plot.Z[STATE_VX] = 10.f;
-      prefusedObject.plot.Z[STATE_VY] = 0.f;
-      prefusedObject.plot.R[KALMAN_STATES * STATE_X + STATE_X] = 0.f;
-      prefusedObject.plot.R[KALMAN_STATES * STATE_Y + STATE_Y] = 0.f;
-      prefusedObject.plot.R[KALMAN_STATES * STATE_VX + STATE_VX] = 0.f;
-      prefusedObject.plot.R[KALMAN_STATES * STATE_VY + STATE_VY] = 0.f;
-
-      fusedObject.id = 1u;
-      fusedObject.track.X[STATE_X] = 4.f;
-      fusedObject.track.X[STATE_Y] = 3.f;
-      fusedObject.track.X[STATE_VX] = 10.f;
-      fusedObject.track.X[STATE_VY] = 0.f;
-      fusedObject.track.P[KALMAN_STATES * STATE_X + STATE_X] = 0.f;
-      fusedObject.track.P[KALMAN_STATES * STATE_Y + STATE_Y] = 0.f;
-      fusedObject.track.P[KALMAN_STATES * STATE_VX + STATE_VX] = 0.f;
-      fusedObject.track.P[KALMAN_STATES * STATE_VY + STATE_VY] = 0.f;
-
-      gatingQuality = GetGatingValue(&prefusedObject, &fusedObject);
+      real_t gatingQuality;
+
+      GatingTracks_t gatingTracks;
+      Plot_t plot;
+      real_t X[KALMAN_STATES];
+      real_t variance[KALMAN_STATES];
+      real_t weights[KALMAN_STATES] = { GATING_WEIGHT_X, GATING_WEIGHT_Y, GATING_WEIGHT_VX, GATING_WEIGHT_VY };
+
+      (void)memset(&gatingTracks, 0, sizeof(gatingTracks));
+      (void)memset(&plot, 0, sizeof(plot));
+
+      plot.Z[STATE_X] = 4.f;
+      plot.Z[STATE_Y] = 3.f;
+      plot.Z[STATE_VX] = 10.f;
+      plot.Z[STATE_VY] = 0.f;
+      plot.R[KALMAN_STATES * STATE_X + STATE_X] = 0.f;
+      plot.R[KALMAN_STATES * STATE_Y + STATE_Y] = 0.f;
+      plot.R[KALMAN_STATES * STATE_VX + STATE_VX] = 0.f;
+      plot.R[KALMAN_STATES * STATE_VY + STATE_VY] = 0.f;
+
+      X[STATE_X] = 4.f;
+      X[STATE_Y] = 3.f;
+      X[STATE_VX] = 10.f;
+      X[STATE_VY] = 0.f;
+      variance[STATE_X] = 0.f;
+      variance[STATE_Y] = 0.f;
+      variance[STATE_VX] = 0.f;
+      variance[STATE_VY] = 0.f;
+
+      SetGatingTrack(&gatingTracks, 0u, X, variance, weights);
+
+      gatingQuality = GetGatingValue(&gatingTracks, 0u, &plot, weights);
 
       EXPECT_EQ(gatingQuality, INVALID_GATING_VALUE);
    }
 
-}
\ No newline at end of file
+}
@@ -0,0 +1,177 @@
+/*
+ * Copyright (C) 2016 Dimitris Geromichalos
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "stdafx.h"
+
+#include "gtest/gtest.h"
+
+#include <string.h>
+
+#include "platform_params.h"
+#include "constants.h"
+#include "radar_utils.h"
+#include "tracking.h"
+#include "gating.h"
+
+#define RELATIVE_TOLERANCE (1e-5f)
+
+namespace
+{
+
+   class GatingTest : public testing::Test
+   {
+   protected:
+
+      GatingTest()
+      {
+      }
+
+      virtual ~GatingTest()
+      {
+      }
+
+      virtual void SetUp()
+      {
+         (void)memset(&gatingTracks, 0, sizeof(GatingTracks_t));
+         (void)memset(&plot, 0, sizeof(Plot_t));
+
+         for (u8_t j = 0u; j < KALMAN_STATES; j++)
+         {
+            plot.Z[j] = 10.f - (2.f * j);
+            plot.R[(KALMAN_STATES * j) + j] = 0.5f + (0.25f * j);
+            weights[j] = (j < 2u) ? 10.f : 30.f;
+         }
+
+         plot.weight = 1.f;
+
+         for (u8_t i = 0u; i < NUM_FUSED_OBJ; i++)
+         {
+            Plot_t trackPlot = plot;
+
+            /* From the same position as the plot (zero distance) to far outside the gate. */
+            for (u8_t j = 0u; j < KALMAN_STATES; j++)
+            {
+               trackPlot.Z[j] += 1.5f * i * (((i + j) % 2u) ? 1.f : -1.f);
+               trackPlot.R[(KALMAN_STATES * j) + j] = 0.2f + (0.1f * i);
+            }
+
+            InitializeTrack(&tracks[i], &trackPlot);
+
+            for (u8_t j = 0u; j < KALMAN_STATES; j++)
+            {
+               variances[i][j] = GetTrackVariance(&tracks[i], j);
+            }
+
+            SetGatingTrack(&gatingTracks, i, tracks[i].X, variances[i], weights);
+         }
+      }
+
+      virtual void TearDown()
+      {
+      }
+
+      /* The gating value from the similarities of the states, with the early exit on the first failed state. */
+      real_t GetReferenceGatingValue(const Track_t* track)
+      {
+         real_t gatingValue = 0.f;
+
+         for (u8_t j = 0u; j < KALMAN_STATES; j++)
+         {
+            real_t similarity = weights[j] * GetSimilarityValue(
+               plot.Z[j], track->X[j], plot.R[(KALMAN_STATES * j) + j], GetTrackVariance(track, j));
+
+            if (similarity > STATE_GATING_VALUE_MIN_LIMIT)
+            {
+               gatingValue += similarity;
+            }
+            else
+            {
+               gatingValue = INVALID_GATING_VALUE;
+               break;
+            }
+         }
+
+         return gatingValue;
+      }
+
+      GatingTracks_t gatingTracks;
+      Track_t tracks[NUM_FUSED_OBJ];
+      KalmanPv_t variances[NUM_FUSED_OBJ];
+      Plot_t plot;
+      real_t weights[KALMAN_STATES];
+   };
+
+   TEST_F(GatingTest, gatingValuesEqualSimilaritySum)
+   {
+      real_t gatingValues[NUM_BATCH_TRACKS];
+      u8_t numInside = 0u;
+
+      GetGatingValues(&gatingTracks, &plot, weights, gatingValues);
+
+      for (u8_t i = 0u; i < NUM_FUSED_OBJ; i++)
+      {
+         real_t reference = GetReferenceGatingValue(&tracks[i]);
+
+         EXPECT_NEAR(gatingValues[i], reference, RELATIVE_TOLERANCE * REAL_FABS(reference));
+
+         numInside += (reference != INVALID_GATING_VALUE);
+      }
+
+      /* Both sides of the gate are covered. */
+      EXPECT_GT(numInside, 0u);
+      EXPECT_LT(numInside, NUM_FUSED_OBJ);
+   }
+
+   TEST_F(GatingTest, zeroDistanceGivesMaxSimilarity)
+   {
+      real_t gatingValues[NUM_BATCH_TRACKS];
+      real_t maxGatingValue = 0.f;
+
+      for (u8_t j = 0u; j < KALMAN_STATES; j++)
+      {
+         maxGatingValue += weights[j] * MAX_SIMILARITY_VALUE;
+      }
+
+      GetGatingValues(&gatingTracks, &plot, weights, gatingValues);
+
+      EXPECT_FLOAT_EQ(gatingValues[0], maxGatingValue);
+   }
+
+   TEST_F(GatingTest, updatedGatingValuesEqualRecalculated)
+   {
+      real_t gatingValues[NUM_BATCH_TRACKS];
+      real_t recalculatedValues[NUM_BATCH_TRACKS];
+
+      GetGatingValues(&gatingTracks, &plot, weights, gatingValues);
+      ClearGatingChanges(&gatingTracks);
+
+      /* Swap the tracks, so that the changed lanes move both inside and outside the gate. */
+      for (u8_t i = 0u; i < NUM_FUSED_OBJ; i += 3u)
+      {
+         SetGatingTrack(&gatingTracks, i, tracks[NUM_FUSED_OBJ - 1u - i].X, variances[NUM_FUSED_OBJ - 1u - i], weights);
+      }
+
+      UpdateGatingValues(&gatingTracks, &plot, weights, gatingValues);
+      GetGatingValues(&gatingTracks, &plot, weights, recalculatedValues);
+
+      for (u8_t i = 0u; i < NUM_FUSED_OBJ; i++)
+      {
+         EXPECT_EQ(gatingValues[i], recalculatedValues[i]);
+      }
+   }
+
+}
@@ -0,0 +1,174 @@
+/*
+ * Copyright (C) 2016 Dimitris Geromichalos
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "stdafx.h"
+
+#include "gtest/gtest.h"
+
+#include <string.h>
+
+#include "platform_params.h"
+#include "tracking.h"
+#include "gating.h"
+#include "gating_workers.h"
+
+namespace
+{
+
+   class GatingWorkersTest : public testing::Test
+   {
+   protected:
+
+      GatingWorkersTest()
+      {
+      }
+
+      virtual ~GatingWorkersTest()
+      {
+      }
+
+      virtual void SetUp()
+      {
+         (void)memset(&gatingTracks, 0, sizeof(GatingTracks_t));
+         (void)memset(prefusedObjectList, 0, sizeof(prefusedObjectList));
+         (void)memset(sensors, 0, sizeof(sensors));
+
+         for (u8_t j = 0u; j < KALMAN_STATES; j++)
+         {
+            weights[j] = (j < 2u) ? 10.f : 30.f;
+         }
+
+         for (u8_t s = 0u; s < NUM_SENSORS; s++)
+         {
+            sensors[s].id = s;
+            sensors[s].type = RADAR;
+         }
+
+         for (u8_t i = 0u; i < NUM_PREFUSED_OBJ; i++)
+         {
+            Plot_t* plot = &prefusedObjectList[i].plot;
+
+            prefusedObjectList[i].sensor = &sensors[i % NUM_SENSORS];
+
+            for (u8_t j = 0u; j < KALMAN_STATES; j++)
+            {
+               plot->Z[j] = 0.75f * i * (((i + j) % 2u) ? 1.f : -1.f);
+               plot->R[(KALMAN_STATES * j) + j] = 0.5f + (0.05f * i);
+            }
+         }
+
+         for (u8_t i = 0u; i < NUM_FUSED_OBJ; i++)
+         {
+            Plot_t trackPlot = prefusedObjectList[i % NUM_PREFUSED_OBJ].plot;
+
+            trackPlot.Z[STATE_X] += 0.5f;
+            InitializeTrack(&track, &trackPlot);
+
+            for (u8_t j = 0u; j < KALMAN_STATES; j++)
+            {
+               variance[j] = GetTrackVariance(&track, j);
+            }
+
+            SetGatingTrack(&gatingTracks, i, track.X, variance, weights);
+         }
+      }
+
+      virtual void TearDown()
+      {
+      }
+
+      GatingTracks_t gatingTracks;
+      Track_t track;
+      KalmanPv_t variance;
+      Sensor_t sensors[NUM_SENSORS];
+      PrefusedObject_t prefusedObjectList[NUM_PREFUSED_OBJ];
+      real_t weights[KALMAN_STATES];
+   };
+
+   TEST_F(GatingWorkersTest, plotGatingValuesEqualSerial)
+   {
+      /* Only the prefused objects at the front of the list are counted, the rest are left ungated. */
+      const u8_t numPrefusedObjects = NUM_PREFUSED_OBJ - 3u;
+      real_t gatingValues[NUM_PREFUSED_OBJ][NUM_BATCH_TRACKS];
+      real_t serialValues[NUM_BATCH_TRACKS];
+      u8_t gatePlot[NUM_PREFUSED_OBJ];
+
+      for (u8_t i = 0u; i < NUM_PREFUSED_OBJ; i++)
+      {
+         gatePlot[i] = ((i % 3u) != 1u);
+      }
+
+      /* Repeated, so that the workers are reused. */
+      for (u8_t run = 0u; run < 3u; run++)
+      {
+         (void)memset(gatingValues, 0, sizeof(gatingValues));
+
+         GetPlotGatingValues(&gatingTracks, prefusedObjectList, numPrefusedObjects, gatePlot, weights, gatingValues);
+
+         for (u8_t i = 0u; i < NUM_PREFUSED_OBJ; i++)
+         {
+            if ((i < numPrefusedObjects) && gatePlot[i])
+            {
+               GetGatingValues(&gatingTracks, &prefusedObjectList[i].plot, weights, serialValues);
+            }
+            else
+            {
+               (void)memset(serialValues, 0, sizeof(serialValues));
+            }
+
+            for (u8_t j = 0u; j < NUM_FUSED_OBJ; j++)
+            {
+               EXPECT_EQ(gatingValues[i][j], serialValues[j]);
+            }
+         }
+      }
+   }
+
+   TEST_F(GatingWorkersTest, eachShareGatesThePlotsOfItsSensors)
+   {
+      real_t gatingValues[NUM_PREFUSED_OBJ][NUM_BATCH_TRACKS];
+      u8_t gatePlot[NUM_PREFUSED_OBJ];
+      u8_t expectedPlots[GATING_WORKERS + 1u];
+      u8_t numGatedPlots = 0u;
+
+      (void)memset(gatePlot, TRUE, sizeof(gatePlot));
+      (void)memset(expectedPlots, 0, sizeof(expectedPlots));
+
+      /* The sensors of the same type are still dealt to different shares by their index. */
+      for (u8_t i = 0u; i < NUM_PREFUSED_OBJ; i++)
+      {
+         expectedPlots[prefusedObjectList[i].sensor->id % (GATING_WORKERS + 1u)]++;
+      }
+
+      GetPlotGatingValues(&gatingTracks, prefusedObjectList, NUM_PREFUSED_OBJ, gatePlot, weights, gatingValues);
+
+      for (u8_t share = 0u; share <= GATING_WORKERS; share++)
+      {
+         EXPECT_EQ(expectedPlots[share], GetShareGatedPlots(share));
+
+         if (share < NUM_SENSORS)
+         {
+            EXPECT_GT(GetShareGatedPlots(share), 0u);
+         }
+
+         numGatedPlots += GetShareGatedPlots(share);
+      }
+
+      EXPECT_EQ(NUM_PREFUSED_OBJ, numGatedPlots);
+   }
+
+}
@@ -0,0 +1,91 @@
+/*
+ * Copyright (C) 2016 Dimitris Geromichalos
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "stdafx.h"
+
+#include "gtest/gtest.h"
+
+#include "id_allocator.h"
+
+namespace
+{
+
+   class IdAllocatorTest : public testing::Test
+   {
+   protected:
+
+      IdAllocatorTest()
+      {
+      }
+
+      virtual ~IdAllocatorTest()
+      {
+      }
+
+      virtual void SetUp()
+      {
+         ResetIdAllocator(&allocator, MAX_ID);
+      }
+
+      virtual void TearDown()
+      {
+      }
+
+      IdAllocator_t allocator;
+   };
+
+   TEST_F(IdAllocatorTest, allIdsAreAllocatedInOrder)
+   {
+      for (u32_t id = (INVALID_ID + 1u); id < MAX_ID; id++)
+      {
+         EXPECT_EQ(AllocateId(&allocator), id);
+      }
+
+      EXPECT_EQ(AllocateId(&allocator), INVALID_ID);
+   }
+
+   TEST_F(IdAllocatorTest, lowestFreedIdIsReused)
+   {
+      for (u32_t id = (INVALID_ID + 1u); id < MAX_ID; id++)
+      {
+         (void)AllocateId(&allocator);
+      }
+
+      FreeId(&allocator, MAX_ID - 1u);
+      FreeId(&allocator, 3u);
+      FreeId(&allocator, INVALID_ID);
+
+      EXPECT_EQ(AllocateId(&allocator), 3u);
+      EXPECT_EQ(AllocateId(&allocator), MAX_ID - 1u);
+      EXPECT_EQ(AllocateId(&allocator), INVALID_ID);
+   }
+
+   TEST_F(IdAllocatorTest, idsStayBelowMaxIdInUse)
+   {
+      const ObjectId_t maxId = MAX_ID / 2u;
+
+      ResetIdAllocator(&allocator, maxId);
+
+      for (u32_t id = (INVALID_ID + 1u); id < maxId; id++)
+      {
+         EXPECT_EQ(AllocateId(&allocator), id);
+      }
+
+      EXPECT_EQ(AllocateId(&allocator), INVALID_ID);
+   }
+
+}
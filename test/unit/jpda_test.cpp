@@ -0,0 +1,168 @@
+/*
+ * Copyright (C) 2016 Dimitris Geromichalos
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "stdafx.h"
+
+#include "gtest/gtest.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "platform_params.h"
+#include "constants.h"
+#include "jpda.h"
+
+#define NUM_ROWS (5u)
+#define NONE_LIKELIHOOD (0.4f)
+#define MAX_HYPOTHESES (1000u)
+#define TOLERANCE (1e-5f)
+
+namespace
+{
+
+   class JpdaTest : public testing::Test
+   {
+   protected:
+
+      JpdaTest()
+      {
+      }
+
+      virtual ~JpdaTest()
+      {
+      }
+
+      virtual void SetUp()
+      {
+         (void)memset(&workspace, 0, sizeof(JpdaWorkspace_t));
+         (void)memset(&stats, 0, sizeof(AssociationStats_t));
+         (void)memset(weights, 0, sizeof(weights));
+
+         for (u8_t i = 0u; i < NUM_ROWS; i++)
+         {
+            for (u8_t j = 0u; j < MAX_ASSIGNMENT_COLS; j++)
+            {
+               cost[i][j] = (j < NUM_FUSED_OBJ) ? FORBIDDEN_ASSIGNMENT_COST : DUMMY_ASSIGNMENT_COST;
+            }
+         }
+
+         srand(11u);
+      }
+
+      virtual void TearDown()
+      {
+      }
+
+      /* Sums the weight of every joint hypothesis of all the rows (not split into clusters) into the weights of its pairs. */
+      f64_t AddBruteForceWeights(const u8_t row, const f64_t weight, u8_t* pairs, u8_t* usedCols)
+      {
+         f64_t total = 0.;
+
+         if (row == NUM_ROWS)
+         {
+            for (u8_t i = 0u; i < NUM_ROWS; i++)
+            {
+               weights[i][pairs[i]] += weight;
+            }
+
+            total = weight;
+         }
+         else
+         {
+            pairs[row] = JPDA_NONE_COL;
+            total += AddBruteForceWeights(row + 1u, weight * NONE_LIKELIHOOD, pairs, usedCols);
+
+            for (u8_t j = 0u; j < NUM_FUSED_OBJ; j++)
+            {
+               if ((cost[row][j] < DUMMY_ASSIGNMENT_COST) && !usedCols[j])
+               {
+                  usedCols[j] = TRUE;
+                  pairs[row] = j;
+                  total += AddBruteForceWeights(row + 1u, weight * -cost[row][j], pairs, usedCols);
+                  usedCols[j] = FALSE;
+               }
+            }
+         }
+
+         return total;
+      }
+
+      JpdaWorkspace_t workspace;
+      AssociationStats_t stats;
+      real_t cost[MAX_ASSIGNMENT_ROWS][MAX_ASSIGNMENT_COLS];
+      f64_t weights[NUM_ROWS][NUM_FUSED_OBJ + 1u];
+   };
+
+   TEST_F(JpdaTest, marginalsEqualBruteForce)
+   {
+      u8_t pairs[NUM_ROWS];
+      u8_t usedCols[NUM_FUSED_OBJ] = { 0u };
+
+      /* Two clusters that share no column, and a row without any gated column. */
+      for (u8_t i = 0u; i < (NUM_ROWS - 1u); i++)
+      {
+         for (u8_t j = ((i < 2u) ? 0u : 8u); j < ((i < 2u) ? 4u : 12u); j++)
+         {
+            if ((rand() % 3) != 0)
+            {
+               cost[i][j] = -(0.5f + (10.f * (real_t)rand() / (real_t)RAND_MAX));
+            }
+         }
+      }
+
+      SolveJpda(&workspace, cost, NUM_ROWS, NONE_LIKELIHOOD, MAX_HYPOTHESES, &stats);
+
+      f64_t total = AddBruteForceWeights(0u, 1., pairs, usedCols);
+
+      for (u8_t i = 0u; i < NUM_ROWS; i++)
+      {
+         EXPECT_FALSE(workspace.fallback[i]);
+
+         for (u8_t j = 0u; j <= JPDA_NONE_COL; j++)
+         {
+            EXPECT_NEAR(workspace.marginal[i][j], weights[i][j] / total, TOLERANCE);
+         }
+      }
+
+      EXPECT_EQ(stats.clusters, 3u);
+      EXPECT_EQ(stats.fallbacks, 0u);
+   }
+
+   TEST_F(JpdaTest, largeClusterFallsBack)
+   {
+      /* All the rows gate all the columns, a single cluster of more hypotheses than allowed. */
+      for (u8_t i = 0u; i < NUM_ROWS; i++)
+      {
+         for (u8_t j = 0u; j < NUM_FUSED_OBJ; j++)
+         {
+            cost[i][j] = -1.f;
+         }
+      }
+
+      SolveJpda(&workspace, cost, NUM_ROWS, NONE_LIKELIHOOD, MAX_HYPOTHESES, &stats);
+
+      for (u8_t i = 0u; i < NUM_ROWS; i++)
+      {
+         EXPECT_TRUE(workspace.fallback[i]);
+      }
+
+      EXPECT_EQ(stats.clusters, 1u);
+      EXPECT_EQ(stats.hypotheses, MAX_HYPOTHESES);
+      EXPECT_EQ(stats.fallbacks, 1u);
+   }
+
+}
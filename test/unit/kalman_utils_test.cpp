@@ -0,0 +1,351 @@
+/*
+ * Copyright (C) 2016 Dimitris Geromichalos
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "stdafx.h"
+
+#include "gtest/gtest.h"
+
+#include <string.h>
+#include <math.h>
+
+#include "algorithm_types.h"
+#include "kalman_utils.h"
+#include "kalman_kernels.h"
+
+#include "../benchmark/q16_axis.h"
+
+#define DT (0.04f)
+#define VAR_Q_POS (2.25f)
+#define VAR_Q_VEL (9.f)
+#define TOLERANCE (1e-4f)
+#define Q16_TOLERANCE (1e-2f)
+
+namespace
+{
+
+   DEFINE_KALMAN_KERNELS(2)
+   DEFINE_KALMAN_KERNELS(6)
+
+   class KalmanUtilsTest : public testing::Test
+   {
+   protected:
+
+      KalmanUtilsTest()
+      {
+      }
+
+      virtual ~KalmanUtilsTest()
+      {
+      }
+
+      virtual void SetUp()
+      {
+         const real_t R[KALMAN_STATES] = { 0.4f, 0.9f, 2.25f, 2.25f };
+
+         (void)memset(F, 0, sizeof(KalmanF_t));
+         (void)memset(Q, 0, sizeof(KalmanQ_t));
+         (void)memset(P, 0, sizeof(KalmanP_t));
+
+         for (int i = 0; i < KALMAN_STATES; i++)
+         {
+            F[(KALMAN_STATES * i) + i] = 1.f;
+            P[(KALMAN_STATES * i) + i] = R[i];
+            X[i] = 10.f - (3.f * i);
+            Xaxis[i] = X[i];
+            this->R[i] = R[i];
+         }
+
+         for (int a = 0; a < KALMAN_AXES; a++)
+         {
+            int pos = GET_STATE_FROM_AXIS(a, 0);
+            int vel = GET_STATE_FROM_AXIS(a, 1);
+
+            F[(KALMAN_STATES * pos) + vel] = DT;
+
+            Q[(KALMAN_STATES * pos) + pos] = (VAR_Q_POS * DT) + ((VAR_Q_VEL * DT * DT * DT) / 3.f);
+            Q[(KALMAN_STATES * pos) + vel] = (VAR_Q_VEL * DT * DT) / 2.f;
+            Q[(KALMAN_STATES * vel) + pos] = Q[(KALMAN_STATES * pos) + vel];
+            Q[(KALMAN_STATES * vel) + vel] = VAR_Q_VEL * DT;
+
+            Qaxis[a][0] = Q[(KALMAN_STATES * pos) + pos];
+            Qaxis[a][1] = Q[(KALMAN_STATES * pos) + vel];
+            Qaxis[a][2] = Q[(KALMAN_STATES * vel) + vel];
+
+            Paxis[a][0] = R[pos];
+            Paxis[a][1] = 0.f;
+            Paxis[a][2] = R[vel];
+         }
+
+         DecomposeUD(Q, Qu, Qd);
+         DecomposeUD(P, U, D);
+      }
+
+      virtual void TearDown()
+      {
+      }
+
+      KalmanF_t F;
+      KalmanQ_t Q;
+      KalmanQu_t Qu;
+      KalmanQd_t Qd;
+      KalmanWorkspace_t workspace;
+      KalmanAxisQ_t Qaxis[KALMAN_AXES];
+
+      KalmanX_t X;
+      KalmanP_t P;
+      KalmanPu_t U;
+      KalmanPd_t D;
+
+      KalmanX_t Xaxis;
+      KalmanAxisP_t Paxis[KALMAN_AXES];
+
+      real_t R[KALMAN_STATES];
+   };
+
+   TEST_F(KalmanUtilsTest, composeDecomposeUD)
+   {
+      KalmanP_t UDU;
+
+      ComposeUD(Qu, Qd, UDU);
+
+      for (int i = 0; i < (KALMAN_STATES * KALMAN_STATES); i++)
+      {
+         EXPECT_NEAR(UDU[i], Q[i], TOLERANCE);
+      }
+   }
+
+   TEST_F(KalmanUtilsTest, composeDiagonalEqualsComposeUD)
+   {
+      KalmanPv_t V;
+
+      for (int cycle = 0; cycle < 5; cycle++)
+      {
+         EstimateCovariance(F, Qu, Qd, U, D, &workspace);
+      }
+
+      ComposeUD(U, D, P);
+      ComposeDiagonalUD(U, D, V);
+
+      for (int i = 0; i < KALMAN_STATES; i++)
+      {
+         EXPECT_EQ(V[i], P[(KALMAN_STATES * i) + i]);
+      }
+   }
+
+   TEST_F(KalmanUtilsTest, specializedKernelsComposeDecompose)
+   {
+      const int N = 6;
+      real_t A[N * N];
+      real_t UDU[N * N];
+      real_t U6[GET_SIZE_UPPER(N)];
+      real_t D6[N];
+
+      for (int i = 0; i < N; i++)
+      {
+         for (int j = 0; j < N; j++)
+         {
+            A[(N * i) + j] = (i == j) ? (2.f + i) : (0.3f / (1.f + i + j));
+         }
+      }
+
+      DecomposeUD6(A, U6, D6);
+      ComposeUD6(U6, D6, UDU);
+
+      for (int i = 0; i < (N * N); i++)
+      {
+         EXPECT_NEAR(UDU[i], A[i], TOLERANCE);
+      }
+   }
+
+   TEST_F(KalmanUtilsTest, specializedKernelsEqualAxisKernel)
+   {
+      const real_t F2[AXIS_STATES * AXIS_STATES] = { 1.f, DT, 0.f, 1.f };
+      const real_t H2[AXIS_STATES] = { 1.f, 0.f };
+      real_t Q2[AXIS_STATES * AXIS_STATES];
+      real_t Qu2[GET_SIZE_UPPER(AXIS_STATES)];
+      real_t Qd2[AXIS_STATES];
+      real_t U2[GET_SIZE_UPPER(AXIS_STATES)];
+      real_t D2[AXIS_STATES];
+      real_t P2[AXIS_STATES * AXIS_STATES];
+      real_t X2[AXIS_STATES] = { Xaxis[STATE_X], Xaxis[STATE_VX] };
+      KalmanWorkspace_t scratch;
+
+      Q2[0] = Qaxis[AXIS_X][0];
+      Q2[1] = Qaxis[AXIS_X][1];
+      Q2[2] = Qaxis[AXIS_X][1];
+      Q2[3] = Qaxis[AXIS_X][2];
+      DecomposeUD2(Q2, Qu2, Qd2);
+
+      P2[0] = Paxis[AXIS_X][0];
+      P2[1] = Paxis[AXIS_X][1];
+      P2[2] = Paxis[AXIS_X][1];
+      P2[3] = Paxis[AXIS_X][2];
+      DecomposeUD2(P2, U2, D2);
+
+      for (int cycle = 0; cycle < 50; cycle++)
+      {
+         real_t Z = X2[0] + (0.3f * sinf((real_t)cycle));
+
+         EstimateCovariance2(F2, Qu2, Qd2, U2, D2, scratch.F, scratch.Qu, scratch.Qd);
+         X2[0] += DT * X2[1];
+         PredictAxis(DT, Qaxis[AXIS_X], &Xaxis[STATE_X], &Xaxis[STATE_VX], Paxis[AXIS_X]);
+
+         FuseState2(Z - X2[0], R[STATE_X], H2, X2, U2, D2);
+         FuseAxis(Z - Xaxis[STATE_X], R[STATE_X], 0u, &Xaxis[STATE_X], &Xaxis[STATE_VX], Paxis[AXIS_X]);
+      }
+
+      ComposeUD2(U2, D2, P2);
+
+      EXPECT_NEAR(X2[0], Xaxis[STATE_X], TOLERANCE);
+      EXPECT_NEAR(X2[1], Xaxis[STATE_VX], TOLERANCE);
+      EXPECT_NEAR(P2[0], Paxis[AXIS_X][0], TOLERANCE);
+      EXPECT_NEAR(P2[1], Paxis[AXIS_X][1], TOLERANCE);
+      EXPECT_NEAR(P2[3], Paxis[AXIS_X][2], TOLERANCE);
+   }
+
+   TEST_F(KalmanUtilsTest, fixedPointAxisKernelEqualsReal)
+   {
+      q16_t posQ16 = Q16_FROM_REAL(Xaxis[STATE_X]);
+      q16_t velQ16 = Q16_FROM_REAL(Xaxis[STATE_VX]);
+      q16_t PQ16[GET_SIZE_UPPER(AXIS_STATES)];
+      q16_t QQ16[GET_SIZE_UPPER(AXIS_STATES)];
+
+      for (unsigned int i = 0u; i < GET_SIZE_UPPER(AXIS_STATES); i++)
+      {
+         PQ16[i] = Q16_FROM_REAL(Paxis[AXIS_X][i]);
+         QQ16[i] = Q16_FROM_REAL(Qaxis[AXIS_X][i]);
+      }
+
+      for (int cycle = 0; cycle < 50; cycle++)
+      {
+         real_t Z = Xaxis[STATE_X] + (0.3f * sinf((real_t)cycle));
+
+         PredictAxis(DT, Qaxis[AXIS_X], &Xaxis[STATE_X], &Xaxis[STATE_VX], Paxis[AXIS_X]);
+         PredictAxisQ16(Q16_FROM_REAL(DT), QQ16, &posQ16, &velQ16, PQ16);
+
+         FuseAxis(Z - Xaxis[STATE_X], R[STATE_X], 0u, &Xaxis[STATE_X], &Xaxis[STATE_VX], Paxis[AXIS_X]);
+         FuseAxisQ16(Q16_FROM_REAL(Z) - posQ16, Q16_FROM_REAL(R[STATE_X]), 0u, &posQ16, &velQ16, PQ16);
+      }
+
+      EXPECT_NEAR(Q16_TO_REAL(posQ16), Xaxis[STATE_X], Q16_TOLERANCE);
+      EXPECT_NEAR(Q16_TO_REAL(velQ16), Xaxis[STATE_VX], Q16_TOLERANCE);
+
+      for (unsigned int i = 0u; i < GET_SIZE_UPPER(AXIS_STATES); i++)
+      {
+         EXPECT_NEAR(Q16_TO_REAL(PQ16[i]), Paxis[AXIS_X][i], Q16_TOLERANCE);
+      }
+   }
+
+   TEST_F(KalmanUtilsTest, decoupledKernelEqualsUD)
+   {
+      KalmanH_t H;
+
+      for (int cycle = 0; cycle < 50; cycle++)
+      {
+         EstimateCovariance(F, Qu, Qd, U, D, &workspace);
+         PredictState(F, X);
+
+         for (int a = 0; a < KALMAN_AXES; a++)
+         {
+            PredictAxis(DT, Qaxis[a], &Xaxis[GET_STATE_FROM_AXIS(a, 0)], &Xaxis[GET_STATE_FROM_AXIS(a, 1)], Paxis[a]);
+         }
+
+         for (int i = 0; i < KALMAN_STATES; i++)
+         {
+            real_t Z = X[i] + (0.3f * sinf((real_t)(cycle + i)));
+            int a = GET_STATE_AXIS(i);
+
+            (void)memset(H, 0, sizeof(KalmanH_t));
+            H[i] = 1.f;
+
+            FuseState(0.8f * (Z - X[i]), R[i], H, X, U, D);
+            FuseAxis(0.8f * (Z - Xaxis[i]), R[i], GET_AXIS_STATE(i),
+               &Xaxis[GET_STATE_FROM_AXIS(a, 0)], &Xaxis[GET_STATE_FROM_AXIS(a, 1)], Paxis[a]);
+         }
+      }
+
+      ComposeUD(U, D, P);
+
+      for (int i = 0; i < KALMAN_STATES; i++)
+      {
+         EXPECT_NEAR(Xaxis[i], X[i], TOLERANCE);
+      }
+
+      for (int a = 0; a < KALMAN_AXES; a++)
+      {
+         int pos = GET_STATE_FROM_AXIS(a, 0);
+         int vel = GET_STATE_FROM_AXIS(a, 1);
+
+         EXPECT_NEAR(Paxis[a][0], P[(KALMAN_STATES * pos) + pos], TOLERANCE);
+         EXPECT_NEAR(Paxis[a][1], P[(KALMAN_STATES * pos) + vel], TOLERANCE);
+         EXPECT_NEAR(Paxis[a][2], P[(KALMAN_STATES * vel) + vel], TOLERANCE);
+      }
+
+      /* The axes are never coupled. */
+      EXPECT_NEAR(P[(KALMAN_STATES * STATE_X) + STATE_Y], 0.f, TOLERANCE);
+      EXPECT_NEAR(P[(KALMAN_STATES * STATE_X) + STATE_VY], 0.f, TOLERANCE);
+   }
+
+   TEST_F(KalmanUtilsTest, fuseUnitStatesEqualsFuseState)
+   {
+      KalmanH_t H;
+      KalmanX_t Xunit;
+      KalmanX_t Z;
+      KalmanPu_t Uunit;
+      KalmanPd_t Dunit;
+      KalmanP_t Punit;
+
+      for (int cycle = 0; cycle < 50; cycle++)
+      {
+         EstimateCovariance(F, Qu, Qd, U, D, &workspace);
+         PredictState(F, X);
+
+         (void)memcpy(Xunit, X, sizeof(KalmanX_t));
+         (void)memcpy(Uunit, U, sizeof(KalmanPu_t));
+         (void)memcpy(Dunit, D, sizeof(KalmanPd_t));
+
+         for (int i = 0; i < KALMAN_STATES; i++)
+         {
+            Z[i] = X[i] + (0.3f * sinf((real_t)(cycle + i)));
+         }
+
+         for (int i = 0; i < KALMAN_STATES; i++)
+         {
+            (void)memset(H, 0, sizeof(KalmanH_t));
+            H[i] = 1.f;
+
+            FuseState(0.8f * (Z[i] - X[i]), R[i], H, X, U, D);
+         }
+
+         FuseUnitStates(Z, R, 0.8f, Xunit, Uunit, Dunit);
+
+         for (int i = 0; i < KALMAN_STATES; i++)
+         {
+            EXPECT_NEAR(Xunit[i], X[i], TOLERANCE);
+         }
+
+         ComposeUD(U, D, P);
+         ComposeUD(Uunit, Dunit, Punit);
+
+         for (int i = 0; i < (KALMAN_STATES * KALMAN_STATES); i++)
+         {
+            EXPECT_NEAR(Punit[i], P[i], TOLERANCE);
+         }
+      }
+   }
+
+}
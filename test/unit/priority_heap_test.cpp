@@ -0,0 +1,205 @@
+/*
+ * Copyright (C) 2016 Dimitris Geromichalos
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "stdafx.h"
+
+#include <stdlib.h>
+
+#include "gtest/gtest.h"
+
+#include "fused_object_store.h"
+#include "priority_heap.h"
+
+namespace
+{
+
+   class PriorityHeapTest : public testing::Test
+   {
+   protected:
+
+      PriorityHeapTest()
+      {
+      }
+
+      virtual ~PriorityHeapTest()
+      {
+      }
+
+      virtual void SetUp()
+      {
+         ResetFusedObjectStore(&fusedObjectStore);
+         ResetPriorityHeap(&heap, NUM_FUSED_OBJ);
+
+         srand(7u);
+      }
+
+      virtual void TearDown()
+      {
+      }
+
+      /* The linear scans that the heap replaces. */
+      u8_t GetMinObject()
+      {
+         u8_t minIndex = NUM_FUSED_OBJ;
+
+         for (u8_t i = 0u; i < NUM_FUSED_OBJ; i++)
+         {
+            if ((fusedObjectStore.hot[i].id != INVALID_ID) &&
+                ((minIndex == NUM_FUSED_OBJ) || (fusedObjectStore.hot[i].priority < fusedObjectStore.hot[minIndex].priority)))
+            {
+               minIndex = i;
+            }
+         }
+
+         return minIndex;
+      }
+
+      u8_t GetFreeSlot()
+      {
+         u8_t i;
+
+         for (i = 0u; (i < NUM_FUSED_OBJ) && (fusedObjectStore.hot[i].id != INVALID_ID); i++)
+         {
+         }
+
+         return i;
+      }
+
+      PriorityHeap_t heap;
+      FusedObjectStore_t fusedObjectStore;
+   };
+
+   TEST_F(PriorityHeapTest, builtHeapEqualsLinearScan)
+   {
+      for (u8_t i = 0u; i < NUM_FUSED_OBJ; i++)
+      {
+         if ((rand() % 4) != 0)
+         {
+            fusedObjectStore.hot[i].id = i + 1u;
+            /* Few distinct values, so that ties are resolved by index. */
+            fusedObjectStore.hot[i].priority = (real_t)(rand() % 5);
+            SetFusedObjectLive(&fusedObjectStore, i, TRUE);
+         }
+      }
+
+      BuildPriorityHeap(&heap, &fusedObjectStore);
+
+      EXPECT_EQ(GetHeapMinObject(&heap), GetMinObject());
+      EXPECT_EQ(GetHeapFreeSlot(&heap), GetFreeSlot());
+   }
+
+   TEST_F(PriorityHeapTest, insertAndRemoveEqualLinearScan)
+   {
+      u8_t index;
+
+      ResetPriorityHeap(&heap, NUM_FUSED_OBJ);
+
+      EXPECT_EQ(GetHeapMinObject(&heap), NUM_FUSED_OBJ);
+      EXPECT_EQ(GetHeapFreeSlot(&heap), 0u);
+
+      for (u32_t step = 0u; step < 2000u; step++)
+      {
+         index = (u8_t)(rand() % NUM_FUSED_OBJ);
+
+         if (fusedObjectStore.hot[index].id == INVALID_ID)
+         {
+            fusedObjectStore.hot[index].id = index + 1u;
+            fusedObjectStore.hot[index].priority = (real_t)(rand() % 5);
+
+            InsertHeapObject(&heap, &fusedObjectStore, index);
+         }
+         else
+         {
+            RemoveHeapObject(&heap, &fusedObjectStore, index);
+
+            fusedObjectStore.hot[index].id = INVALID_ID;
+         }
+
+         ASSERT_EQ(GetHeapMinObject(&heap), GetMinObject());
+         ASSERT_EQ(GetHeapFreeSlot(&heap), GetFreeSlot());
+      }
+
+      /* Removing an object that is not in the heap changes nothing. */
+      index = GetFreeSlot();
+
+      if (index < NUM_FUSED_OBJ)
+      {
+         RemoveHeapObject(&heap, &fusedObjectStore, index);
+
+         EXPECT_EQ(GetHeapMinObject(&heap), GetMinObject());
+         EXPECT_EQ(GetHeapFreeSlot(&heap), index);
+      }
+   }
+
+   TEST_F(PriorityHeapTest, slotsBeyondCapacityAreNeverFree)
+   {
+      const u8_t capacity = NUM_FUSED_OBJ / 4u;
+
+      ResetPriorityHeap(&heap, capacity);
+
+      for (u8_t i = 0u; i < capacity; i++)
+      {
+         ASSERT_EQ(GetHeapFreeSlot(&heap), i);
+
+         fusedObjectStore.hot[i].id = i + 1u;
+         fusedObjectStore.hot[i].priority = (real_t)i;
+         SetFusedObjectLive(&fusedObjectStore, i, TRUE);
+
+         InsertHeapObject(&heap, &fusedObjectStore, i);
+      }
+
+      EXPECT_GE(GetHeapFreeSlot(&heap), NUM_FUSED_OBJ);
+
+      /* The capacity is kept when the heap is rebuilt. */
+      BuildPriorityHeap(&heap, &fusedObjectStore);
+
+      EXPECT_GE(GetHeapFreeSlot(&heap), NUM_FUSED_OBJ);
+      EXPECT_EQ(GetHeapMinObject(&heap), 0u);
+   }
+
+   TEST_F(PriorityHeapTest, fullHeapIsEmptiedInPriorityOrder)
+   {
+      /* Above 128 objects, the children of a position no longer fit in a byte (build with e.g. NUM_FUSED_OBJ=200). */
+      real_t lastPriority = -1.f;
+
+      for (u8_t i = 0u; i < NUM_FUSED_OBJ; i++)
+      {
+         fusedObjectStore.hot[i].id = i + 1u;
+         fusedObjectStore.hot[i].priority = (real_t)(rand() % 1000);
+
+         InsertHeapObject(&heap, &fusedObjectStore, i);
+      }
+
+      EXPECT_GE(GetHeapFreeSlot(&heap), NUM_FUSED_OBJ);
+
+      for (u8_t i = 0u; i < NUM_FUSED_OBJ; i++)
+      {
+         u8_t index = GetHeapMinObject(&heap);
+
+         ASSERT_EQ(index, GetMinObject());
+         ASSERT_GE(fusedObjectStore.hot[index].priority, lastPriority);
+
+         lastPriority = fusedObjectStore.hot[index].priority;
+
+         RemoveHeapObject(&heap, &fusedObjectStore, index);
+         fusedObjectStore.hot[index].id = INVALID_ID;
+      }
+
+      EXPECT_EQ(GetHeapMinObject(&heap), NUM_FUSED_OBJ);
+   }
+
+}
@@ -0,0 +1,162 @@
+/*
+ * Copyright (C) 2016 Dimitris Geromichalos
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "stdafx.h"
+
+#include "gtest/gtest.h"
+
+#include <string.h>
+
+#include "platform_params.h"
+#include "constants.h"
+#include "tracking.h"
+#include "track_grid.h"
+
+namespace
+{
+
+   class TrackGridTest : public testing::Test
+   {
+   protected:
+
+      TrackGridTest()
+      {
+      }
+
+      virtual ~TrackGridTest()
+      {
+      }
+
+      virtual void SetUp()
+      {
+         ResetTrackGrid(&grid);
+
+         for (u8_t i = 0u; i < NUM_FUSED_OBJ; i++)
+         {
+            Plot_t plot;
+
+            (void)memset(&plot, 0, sizeof(Plot_t));
+
+            /* Spread over many cells, on both sides of the axes. */
+            plot.Z[STATE_X] = (GRID_CELL_SIZE * 0.7f * i) - 40.f;
+            plot.Z[STATE_Y] = (i % 2u) ? (-3.f * i) : (5.f * i);
+
+            for (u8_t j = 0u; j < KALMAN_STATES; j++)
+            {
+               plot.R[(KALMAN_STATES * j) + j] = 0.5f + (0.1f * i);
+            }
+
+            InitializeTrack(&tracks[i], &plot);
+
+            for (u8_t j = 0u; j < KALMAN_STATES; j++)
+            {
+               variances[i][j] = GetTrackVariance(&tracks[i], j);
+            }
+
+            InsertGridTrack(&grid, i, tracks[i].X, variances[i]);
+         }
+      }
+
+      virtual void TearDown()
+      {
+      }
+
+      bool IsCandidate(const u8_t* candidates, const u8_t count, const u8_t index)
+      {
+         bool found = false;
+
+         for (u8_t i = 0u; i < count; i++)
+         {
+            found = found || (candidates[i] == index);
+         }
+
+         return found;
+      }
+
+      TrackGrid_t grid;
+      Track_t tracks[NUM_FUSED_OBJ];
+      KalmanPv_t variances[NUM_FUSED_OBJ];
+   };
+
+   TEST_F(TrackGridTest, smallGridReturnsAllTracks)
+   {
+      u8_t candidates[NUM_FUSED_OBJ];
+
+      ResetTrackGrid(&grid);
+
+      for (u8_t i = 0u; i < MIN_GRID_QUERY_TRACKS; i++)
+      {
+         InsertGridTrack(&grid, i, tracks[i].X, variances[i]);
+      }
+
+      EXPECT_EQ(GetGridCandidates(&grid, 0.f, 0.f, 0.f, 0.f, candidates), MIN_GRID_QUERY_TRACKS);
+   }
+
+   TEST_F(TrackGridTest, candidatesContainAllTracksInsideBox)
+   {
+      u8_t candidates[NUM_FUSED_OBJ];
+
+      for (int q = 0; q < 50; q++)
+      {
+         real_t x = -50.f + (2.3f * q);
+         real_t y = -30.f + (1.7f * q);
+         real_t radiusX = 1.f + (0.4f * (q % 7));
+         real_t radiusY = 2.f + (0.3f * (q % 5));
+         u8_t count = GetGridCandidates(&grid, x, y, radiusX * radiusX, radiusY * radiusY, candidates);
+
+         ASSERT_LE(count, NUM_FUSED_OBJ);
+
+         for (u8_t i = 0u; i < NUM_FUSED_OBJ; i++)
+         {
+            if ((REAL_FABS(tracks[i].X[STATE_X] - x) <= radiusX) &&
+                (REAL_FABS(tracks[i].X[STATE_Y] - y) <= radiusY))
+            {
+               EXPECT_TRUE(IsCandidate(candidates, count, i));
+            }
+         }
+
+         for (u8_t i = 0u; i < count; i++)
+         {
+            for (u8_t j = (i + 1u); j < count; j++)
+            {
+               EXPECT_NE(candidates[i], candidates[j]);
+            }
+         }
+      }
+   }
+
+   TEST_F(TrackGridTest, removedTrackIsNotCandidate)
+   {
+      u8_t candidates[NUM_FUSED_OBJ];
+      u8_t count;
+
+      RemoveGridTrack(&grid, 3u);
+      RemoveGridTrack(&grid, 3u);
+
+      count = GetGridCandidates(&grid, 0.f, 0.f, 1e6f, 1e6f, candidates);
+
+      EXPECT_EQ(count, NUM_FUSED_OBJ - 1u);
+      EXPECT_FALSE(IsCandidate(candidates, count, 3u));
+
+      InsertGridTrack(&grid, 3u, tracks[3].X, variances[3]);
+
+      count = GetGridCandidates(&grid, tracks[3].X[STATE_X], tracks[3].X[STATE_Y], 0.f, 0.f, candidates);
+
+      EXPECT_TRUE(IsCandidate(candidates, count, 3u));
+   }
+
+}
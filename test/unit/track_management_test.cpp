@@ -19,12 +19,21 @@
 
 #include "gtest/gtest.h"
 
+#include <string.h>
+
+#include "platform_params.h"
+#include "constants.h"
+#include "config.h"
 #include "fusion.h"
 #include "fusion_utils.h"
+#include "fused_object_store.h"
 
 namespace
 {
 
+   /* The maximum capacities of the algorithm. */
+   const AlgorithmConfig_t algorithmConfig = { NUM_PREFUSED_OBJ, NUM_FUSED_OBJ, NUM_SENSORS, MAX_ID };
+
    class TrackManagementTest : public testing::Test
    {
    protected:
@@ -39,12 +48,15 @@ namespace
 
       virtual void SetUp()
       {
-         InitializeFusion();
+         InitializeFusion(&algorithmConfig);
+         ResetFusedObjectStore(&store);
       }
 
       virtual void TearDown()
       {
       }
+
+      FusedObjectStore_t store;
    };
 
    TEST_F(TrackManagementTest, objectPruning1)
@@ -52,6 +64,9 @@ namespace
       FusedObject_t fusedObject1;
       FusedObject_t fusedObject2;
 
+      (void)memset(&fusedObject1, 0, sizeof(fusedObject1));
+      (void)memset(&fusedObject2, 0, sizeof(fusedObject2));
+
       fusedObject1.id = 1u;
       fusedObject1.priority = 145.f;
       fusedObject1.track.X[STATE_X] = 40.f;
@@ -66,17 +81,21 @@ namespace
       fusedObject2.track.X[STATE_VX] = 10.f;
       fusedObject2.track.X[STATE_VY] = 0.f;
 
-      CheckObjectsForPruning(&fusedObject1, &fusedObject2);
+      SetFusedObject(&store, 0u, &fusedObject1);
+      SetFusedObject(&store, 1u, &fusedObject2);
 
-      EXPECT_EQ(fusedObject1.id, 1u);
-      EXPECT_EQ(fusedObject2.id, 2u);
+      CheckObjectsForPruning(&store, 0u, 1u);
 
-      fusedObject1.track.X[STATE_X] = 4.f;
+      EXPECT_EQ(store.hot[0].id, 1u);
+      EXPECT_EQ(store.hot[1].id, 2u);
+
+      store.cold[0].track.X[STATE_X] = 4.f;
+      UpdateHotFusedObject(&store, 0u);
 
-      CheckObjectsForPruning(&fusedObject1, &fusedObject2);
+      CheckObjectsForPruning(&store, 0u, 1u);
 
-      EXPECT_EQ(fusedObject1.id, 1u);
-      EXPECT_EQ(fusedObject2.id, 0u);
+      EXPECT_EQ(store.hot[0].id, 1u);
+      EXPECT_EQ(store.hot[1].id, 0u);
    }
 
    TEST_F(TrackManagementTest, objectPruning2)
@@ -84,6 +103,9 @@ namespace
       FusedObject_t fusedObject1;
       FusedObject_t fusedObject2;
 
+      (void)memset(&fusedObject1, 0, sizeof(fusedObject1));
+      (void)memset(&fusedObject2, 0, sizeof(fusedObject2));
+
       fusedObject1.id = 1u;
       fusedObject1.priority = 145.f;
       fusedObject1.track.X[STATE_X] = 4.f;
@@ -98,10 +120,232 @@ namespace
       fusedObject2.track.X[STATE_VX] = 10.f;
       fusedObject2.track.X[STATE_VY] = 0.f;
 
-      CheckObjectsForPruning(&fusedObject1, &fusedObject2);
+      SetFusedObject(&store, 0u, &fusedObject1);
+      SetFusedObject(&store, 1u, &fusedObject2);
+
+      CheckObjectsForPruning(&store, 0u, 1u);
+
+      EXPECT_EQ(store.hot[0].id, 0u);
+      EXPECT_EQ(store.hot[1].id, 2u);
+   }
+
+   TEST_F(TrackManagementTest, pruneObjectsEqualsPairwiseCheck)
+   {
+      FusedObject_t sweptList[NUM_FUSED_OBJ];
+      FusedObjectStore_t pairwiseStore;
+      u32_t seed = 12345u;
+
+      for (int trial = 0; trial < 200; trial++)
+      {
+         (void)memset(sweptList, 0, sizeof(sweptList));
+
+         for (u8_t i = 0u; i < NUM_FUSED_OBJ; i++)
+         {
+            seed = (seed * 1103515245u) + 12345u;
+
+            /* Dense clusters, so that chains of close objects (and ties in x and priority) occur. */
+            sweptList[i].id = ((seed >> 8u) % 5u) ? (i + 1u) : INVALID_ID;
+            sweptList[i].track.X[STATE_X] = (real_t)((seed >> 12u) % 8u) * (PRUNE_LIMIT_X * 0.75f);
+            sweptList[i].track.X[STATE_Y] = (real_t)((seed >> 16u) % 3u) * (PRUNE_LIMIT_Y * 0.75f);
+            sweptList[i].track.X[STATE_VX] = (real_t)((seed >> 20u) % 2u) * PRUNE_LIMIT_VX;
+            sweptList[i].priority = (real_t)((seed >> 24u) % 4u);
+         }
+
+         for (u8_t i = 0u; i < NUM_FUSED_OBJ; i++)
+         {
+            SetFusedObject(&store, i, &sweptList[i]);
+            SetFusedObject(&pairwiseStore, i, &sweptList[i]);
+         }
+
+         PruneObjects(&store);
+
+         for (u8_t i = 0u; i < NUM_FUSED_OBJ; i++)
+         {
+            for (u8_t j = (i + 1u); j < NUM_FUSED_OBJ; j++)
+            {
+               if ((pairwiseStore.hot[i].id != INVALID_ID) && (pairwiseStore.hot[j].id != INVALID_ID))
+               {
+                  CheckObjectsForPruning(&pairwiseStore, i, j);
+               }
+            }
+         }
+
+         for (u8_t i = 0u; i < NUM_FUSED_OBJ; i++)
+         {
+            EXPECT_EQ(store.hot[i].id, pairwiseStore.hot[i].id);
+         }
+      }
+   }
+
+   TEST_F(TrackManagementTest, sensorObjectFollowsAssociationHint)
+   {
+      Sensor_t sensor;
+      PrefusedObject_t prefusedObjectList[NUM_PREFUSED_OBJ];
+      real_t hintedY[2];
+
+      (void)memset(&sensor, 0, sizeof(sensor));
+      sensor.tf.fov = 140.f;
+
+      /* The plot is nearer to the first object, but its sensor object ID was associated with the second one. */
+      for (u8_t sensorObjectId = 0u; sensorObjectId < 2u; sensorObjectId++)
+      {
+         InitializeFusion(&algorithmConfig);
+
+         ResetFusedObjectStore(&store);
+         (void)memset(prefusedObjectList, 0, sizeof(prefusedObjectList));
+
+         CreatePrefusedObject(&prefusedObjectList[0], &sensor, 20.f, 8.f, 0.f, 0.f);
+         CreatePrefusedObject(&prefusedObjectList[1], &sensor, 20.f, -8.f, 0.f, 0.f);
+         prefusedObjectList[0].sensorObjectId = 5u;
+         prefusedObjectList[1].sensorObjectId = sensorObjectId ? 6u : NO_SENSOR_OBJECT_ID;
+
+         RunFusion(prefusedObjectList, 2u, &store, CYCLE_TIME);
+
+         ASSERT_NE(store.hot[0].id, INVALID_ID);
+         ASSERT_NE(store.hot[1].id, INVALID_ID);
+
+         (void)memset(prefusedObjectList, 0, sizeof(prefusedObjectList));
+
+         CreatePrefusedObject(&prefusedObjectList[0], &sensor, 20.f, 2.f, 0.f, 0.f);
+         prefusedObjectList[0].sensorObjectId = sensorObjectId ? 6u : NO_SENSOR_OBJECT_ID;
 
-      EXPECT_EQ(fusedObject1.id, 0u);
-      EXPECT_EQ(fusedObject2.id, 2u);
+         RunFusion(prefusedObjectList, 1u, &store, CYCLE_TIME);
+
+         hintedY[sensorObjectId] = store.cold[1].track.X[STATE_Y];
+
+         if (sensorObjectId)
+         {
+            EXPECT_GT(store.cold[1].track.X[STATE_Y], -8.f);
+            EXPECT_EQ(store.cold[0].track.X[STATE_Y], 8.f);
+         }
+         else
+         {
+            EXPECT_LT(store.cold[0].track.X[STATE_Y], 8.f);
+            EXPECT_EQ(store.cold[1].track.X[STATE_Y], -8.f);
+         }
+      }
+
+      EXPECT_GT(hintedY[1], hintedY[0]);
+   }
+
+   TEST_F(TrackManagementTest, overlappingSensorsPairWithTheSameObject)
+   {
+      Sensor_t sensors[2];
+      PrefusedObject_t prefusedObjectList[NUM_PREFUSED_OBJ];
+      u8_t numObjects = 0u;
+
+      (void)memset(sensors, 0, sizeof(sensors));
+      (void)memset(prefusedObjectList, 0, sizeof(prefusedObjectList));
+
+      for (u8_t s = 0u; s < 2u; s++)
+      {
+         sensors[s].id = s;
+         sensors[s].type = RADAR;
+         sensors[s].tf.fov = 140.f;
+      }
+
+      CreatePrefusedObject(&prefusedObjectList[0], &sensors[0], 20.f, 2.f, 0.f, 0.f);
+      RunFusion(prefusedObjectList, 1u, &store, CYCLE_TIME);
+
+      /* Both radars see the object, so that each of them is paired with its track in its own assignment problem.
+         The objects are counted before they are managed, so that a duplicate is not hidden by the pruning. */
+      CreatePrefusedObject(&prefusedObjectList[0], &sensors[0], 20.f, 2.2f, 0.f, 0.f);
+      CreatePrefusedObject(&prefusedObjectList[1], &sensors[1], 20.2f, 2.f, 0.f, 0.f);
+
+      BuildTrackGrid(&store);
+      GatePrefusedObjects(prefusedObjectList, 2u);
+
+      for (u8_t s = 0u; s < 2u; s++)
+      {
+         AssociateSensorObjects(prefusedObjectList, 2u, s, &store);
+      }
+
+      for (u8_t i = GetNextLiveFusedObject(&store, 0u); i < NUM_FUSED_OBJ; i = GetNextLiveFusedObject(&store, i + 1u))
+      {
+         numObjects++;
+      }
+
+      EXPECT_EQ(1u, numObjects);
+   }
+
+   TEST_F(TrackManagementTest, hypothesesTakeOnePlotOfEachSensor)
+   {
+      Sensor_t sensors[2];
+      PrefusedObject_t prefusedObjectList[NUM_PREFUSED_OBJ];
+      AssociationStats_t stats;
+      u8_t numObjects = 0u;
+
+      (void)memset(sensors, 0, sizeof(sensors));
+      (void)memset(prefusedObjectList, 0, sizeof(prefusedObjectList));
+      (void)memset(&stats, 0, sizeof(stats));
+
+      for (u8_t s = 0u; s < 2u; s++)
+      {
+         sensors[s].id = s;
+         sensors[s].type = RADAR;
+         sensors[s].tf.fov = 140.f;
+      }
+
+      CreatePrefusedObject(&prefusedObjectList[0], &sensors[0], 20.f, 2.f, 0.f, 0.f);
+      RunFusion(prefusedObjectList, 1u, &store, CYCLE_TIME);
+
+      /* The plots of the two radars never compete for the track, so that each radar forms a cluster of its own. */
+      CreatePrefusedObject(&prefusedObjectList[0], &sensors[0], 20.f, 2.2f, 0.f, 0.f);
+      CreatePrefusedObject(&prefusedObjectList[1], &sensors[1], 20.2f, 2.f, 0.f, 0.f);
+
+      BuildTrackGrid(&store);
+      GatePrefusedObjects(prefusedObjectList, 2u);
+
+      for (u8_t s = 0u; s < 2u; s++)
+      {
+         AssociateSensorHypotheses(prefusedObjectList, 2u, s, &store, &stats);
+      }
+
+      for (u8_t i = GetNextLiveFusedObject(&store, 0u); i < NUM_FUSED_OBJ; i = GetNextLiveFusedObject(&store, i + 1u))
+      {
+         numObjects++;
+      }
+
+      EXPECT_EQ(2u, stats.clusters);
+      EXPECT_EQ(0u, stats.fallbacks);
+      EXPECT_EQ(1u, numObjects);
+   }
+
+   TEST_F(TrackManagementTest, slotWithoutIdIsLeftFree)
+   {
+      /* Two IDs (1 and 2) for four slots. */
+      const AlgorithmConfig_t smallIdConfig = { NUM_PREFUSED_OBJ, 4u, NUM_SENSORS, 3u };
+      Sensor_t sensor;
+      PrefusedObject_t prefusedObjectList[NUM_PREFUSED_OBJ];
+      u8_t numObjects = 0u;
+
+      (void)memset(&sensor, 0, sizeof(sensor));
+      (void)memset(prefusedObjectList, 0, sizeof(prefusedObjectList));
+      sensor.tf.fov = 140.f;
+
+      InitializeFusion(&smallIdConfig);
+
+      for (u8_t i = 0u; i < 4u; i++)
+      {
+         CreatePrefusedObject(&prefusedObjectList[i], &sensor, 40.f, -45.f + (30.f * i), 0.f, 0.f);
+      }
+
+      RunFusion(prefusedObjectList, 4u, &store, CYCLE_TIME);
+
+      for (u8_t i = GetNextLiveFusedObject(&store, 0u); i < NUM_FUSED_OBJ; i = GetNextLiveFusedObject(&store, i + 1u))
+      {
+         EXPECT_NE(store.hot[i].id, INVALID_ID);
+         numObjects++;
+      }
+
+      EXPECT_EQ(2u, numObjects);
+
+      /* The slots without an ID were never given a track, so that no plot can be paired with them. */
+      for (u8_t i = 2u; i < 4u; i++)
+      {
+         EXPECT_EQ(store.hot[i].id, INVALID_ID);
+         EXPECT_EQ(store.cold[i].track.X[STATE_X], 0.f);
+      }
    }
 
-}
\ No newline at end of file
+}
@@ -0,0 +1,254 @@
+/*
+ * Copyright (C) 2016 Dimitris Geromichalos
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "stdafx.h"
+
+#include "gtest/gtest.h"
+
+#include <string.h>
+
+#include "platform_params.h"
+#include "tracking.h"
+
+#define NUM_TEST_TRACKS (6u)  /* Not a multiple of the vector lanes */
+#define TOLERANCE (1e-5f)
+
+namespace
+{
+
+   class TrackingTest : public testing::Test
+   {
+   protected:
+
+      TrackingTest()
+      {
+      }
+
+      virtual ~TrackingTest()
+      {
+      }
+
+      virtual void SetUp()
+      {
+         InitializeTracking(&model, CYCLE_TIME);
+         process = GetTrackingProcess(&model, CYCLE_TIME);
+
+         for (u8_t i = 0u; i < NUM_TEST_TRACKS; i++)
+         {
+            Plot_t plot;
+
+            (void)memset(&plot, 0, sizeof(Plot_t));
+
+            plot.Z[STATE_X] = 5.f * i;
+            plot.Z[STATE_Y] = -2.f + i;
+            plot.Z[STATE_VX] = 10.f - i;
+            plot.Z[STATE_VY] = 0.5f * i;
+            plot.R[(KALMAN_STATES * STATE_X) + STATE_X] = 0.25f + (0.1f * i);
+            plot.R[(KALMAN_STATES * STATE_Y) + STATE_Y] = 0.5f + (0.2f * i);
+            plot.R[(KALMAN_STATES * STATE_VX) + STATE_VX] = 2.25f;
+            plot.R[(KALMAN_STATES * STATE_VY) + STATE_VY] = 2.25f;
+            plot.weight = 1.f;
+
+            InitializeTrack(&tracks[i], &plot);
+         }
+      }
+
+      virtual void TearDown()
+      {
+      }
+
+      TrackingModel_t model;
+      const TrackingProcess_t* process;
+      Track_t tracks[NUM_TEST_TRACKS];
+      TrackBatch_t batch;
+   };
+
+   TEST_F(TrackingTest, batchPredictEqualsPredict)
+   {
+      Track_t track;
+
+      batch.count = 0u;
+
+      for (u8_t i = 0u; i < NUM_TEST_TRACKS; i++)
+      {
+         SetBatchTrack(&batch, batch.count++, &tracks[i]);
+      }
+
+      for (int cycle = 0; cycle < 10; cycle++)
+      {
+         PredictTracks(process, &batch);
+
+         for (u8_t i = 0u; i < NUM_TEST_TRACKS; i++)
+         {
+            PredictTrack(process, &tracks[i]);
+         }
+      }
+
+      for (u8_t i = 0u; i < NUM_TEST_TRACKS; i++)
+      {
+         GetBatchTrack(&batch, i, &track);
+
+         for (u8_t j = 0u; j < KALMAN_STATES; j++)
+         {
+            EXPECT_NEAR(track.X[j], tracks[i].X[j], TOLERANCE);
+            EXPECT_NEAR(GetTrackVariance(&track, j), GetTrackVariance(&tracks[i], j), TOLERANCE);
+         }
+      }
+   }
+
+   TEST_F(TrackingTest, processCacheQuantizesDeltaTime)
+   {
+      EXPECT_EQ(GetTrackingProcess(&model, CYCLE_TIME + 0.0002f), process);
+      EXPECT_NE(GetTrackingProcess(&model, CYCLE_TIME / 2.f), process);
+      EXPECT_EQ(GetTrackingProcess(&model, CYCLE_TIME), process);
+   }
+
+   TEST_F(TrackingTest, twoHalfStepsEqualOneStep)
+   {
+      const TrackingProcess_t* halfProcess = GetTrackingProcess(&model, CYCLE_TIME / 2.f);
+      Track_t track = tracks[0];
+
+      PredictTrack(halfProcess, &track);
+      PredictTrack(halfProcess, &track);
+      PredictTrack(process, &tracks[0]);
+
+      for (u8_t j = 0u; j < KALMAN_STATES; j++)
+      {
+         EXPECT_NEAR(track.X[j], tracks[0].X[j], TOLERANCE);
+         EXPECT_NEAR(GetTrackVariance(&track, j), GetTrackVariance(&tracks[0], j), TOLERANCE);
+      }
+   }
+
+   TEST_F(TrackingTest, informationFusionEqualsSequentialFusion)
+   {
+      PlotInformation_t information;
+      Track_t track;
+      Plot_t plots[2];
+      KalmanP_t P, Pinfo;
+
+      (void)memset(&information, 0, sizeof(PlotInformation_t));
+      (void)memset(plots, 0, sizeof(plots));
+
+      for (u8_t i = 0u; i < 2u; i++)
+      {
+         for (u8_t j = 0u; j < KALMAN_STATES; j++)
+         {
+            plots[i].Z[j] = tracks[0].X[j] + (0.5f * (i + 1u)) - (0.2f * j);
+            plots[i].R[(KALMAN_STATES * j) + j] = 0.3f + (0.4f * i) + (0.1f * j);
+         }
+
+         plots[i].weight = 1.f;
+      }
+
+      PredictTrack(process, &tracks[0]);
+      track = tracks[0];
+
+      for (u8_t i = 0u; i < 2u; i++)
+      {
+         AccumulatePlotInformation(&information, &plots[i]);
+         FuseTrack(&tracks[0], &plots[i]);
+      }
+
+      FusePlotInformation(&track, &information);
+
+      GetTrackCovariance(&tracks[0], P);
+      GetTrackCovariance(&track, Pinfo);
+
+      for (u8_t j = 0u; j < KALMAN_STATES; j++)
+      {
+         EXPECT_NEAR(track.X[j], tracks[0].X[j], TOLERANCE);
+      }
+
+      for (u8_t j = 0u; j < (KALMAN_STATES * KALMAN_STATES); j++)
+      {
+         EXPECT_NEAR(Pinfo[j], P[j], TOLERANCE);
+      }
+   }
+
+   TEST_F(TrackingTest, weightedInformationInflatesNoise)
+   {
+      PlotInformation_t information;
+      Track_t track;
+      Plot_t plot, inflatedPlot;
+      KalmanP_t P, Pinfo;
+
+      (void)memset(&information, 0, sizeof(PlotInformation_t));
+      (void)memset(&plot, 0, sizeof(Plot_t));
+
+      /* Predicted, so that the covariance of the track is correlated. */
+      for (u8_t k = 0u; k < 5u; k++)
+      {
+         PredictTrack(process, &tracks[1]);
+      }
+
+      track = tracks[1];
+
+      for (u8_t j = 0u; j < KALMAN_STATES; j++)
+      {
+         plot.Z[j] = tracks[1].X[j] + 1.f;
+         plot.R[(KALMAN_STATES * j) + j] = 0.5f;
+      }
+
+      plot.weight = 0.7f;
+
+      inflatedPlot = plot;
+      inflatedPlot.weight = 1.f;
+
+      for (u8_t j = 0u; j < KALMAN_STATES; j++)
+      {
+         inflatedPlot.R[(KALMAN_STATES * j) + j] = plot.R[(KALMAN_STATES * j) + j] / plot.weight;
+      }
+
+      AccumulatePlotInformation(&information, &plot);
+      FusePlotInformation(&track, &information);
+      FuseTrack(&tracks[1], &inflatedPlot);
+
+      GetTrackCovariance(&tracks[1], P);
+      GetTrackCovariance(&track, Pinfo);
+
+      for (u8_t j = 0u; j < KALMAN_STATES; j++)
+      {
+         EXPECT_NEAR(track.X[j], tracks[1].X[j], TOLERANCE);
+      }
+
+      for (u8_t j = 0u; j < (KALMAN_STATES * KALMAN_STATES); j++)
+      {
+         EXPECT_NEAR(Pinfo[j], P[j], TOLERANCE);
+      }
+   }
+
+   TEST_F(TrackingTest, unweightedPlotIsNotAccumulated)
+   {
+      PlotInformation_t information;
+      Plot_t plot;
+
+      (void)memset(&information, 0, sizeof(PlotInformation_t));
+      (void)memset(&plot, 0, sizeof(Plot_t));
+
+      for (u8_t j = 0u; j < KALMAN_STATES; j++)
+      {
+         plot.R[(KALMAN_STATES * j) + j] = 0.5f;
+      }
+
+      plot.weight = 0.f;
+
+      AccumulatePlotInformation(&information, &plot);
+
+      EXPECT_EQ(information.count, 0u);
+   }
+
+}